@@ -1,22 +1,20 @@
 #include <vector>
 #include <iostream>
-#include <algorithm> // For std::find
 
 
 #include "Graph.hpp"
+#include "Traversal.hpp"
 
 
 
 
-class Graph;
-void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
 
 
 
 
 
 
-       Graph::Graph(int V, bool directed) : V(V), adj(V), directed(directed) {}
+       Graph::Graph(int V, bool directed) : V(V), adj(V), directed(directed), inDeg(V, 0), outDeg(V, 0) {}
 
 
        void Graph::addEdge(int u, int v, int w) // Add edge from u to v
@@ -46,9 +44,13 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
 
 
                adj[u].push_back({v, w}); // Add edge from u to v
+               ++outDeg[u];
+               ++inDeg[v];
               
                if(!directed){
                    adj[v].push_back({u, w});  // For undirected graph
+                   ++outDeg[v];
+                   ++inDeg[u];
                }
           
            }
@@ -139,18 +141,7 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
            }
 
 
-           int in_deg = 0;
-           for (int i = 0; i < V; ++i) // Iterate through all vertices
-           {
-               for (const auto& neighbor : adj[i]) // Check their adjacency lists
-               {
-                   if (neighbor.first == v) // If there's an edge to vertex v
-                   {
-                       ++in_deg;
-                   }
-               }
-           }
-           return in_deg;
+           return inDeg[v]; // Counted incrementally by addEdge
        }
 
 
@@ -161,7 +152,19 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                std::cerr << "Error: Vertex out of bounds (out_degree)" << std::endl;
                return -1;
            }
-           return adj[v].size(); // Out-degree is simply the size of the adjacency list
+           return outDeg[v]; // Same as adj[v].size(), counted incrementally by addEdge
+       }
+
+
+       bool Graph::hasEulerianDegrees() const
+       {
+           for (int i = 0; i < V; ++i)
+           {
+               if (directed ? inDeg[i] != outDeg[i] // Every vertex must be balanced
+                            : outDeg[i] % 2 != 0)    // Every vertex must have even degree
+                   return false;
+           }
+           return true;
        }
       
        bool Graph::isEulerian() const
@@ -183,29 +186,18 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
            }  
 
 
-           if (directed){
-               for(int j = 0; j < V; j++){
-                   if(get_in_degree(j) != get_out_degree(j)){
-                       return false;
-                   }
-               }
-           } else{
-               // For undirected graph, check if all vertices have even degree
-               for (int i = 0; i < V; ++i)
-           {
-               if (degree(i) % 2 != 0) // If any vertex has an odd degree
-                   return false;
-           }
-
-
+           // Directed: in-degree equals out-degree everywhere; undirected: all degrees even
+           if (!hasEulerianDegrees()) {
+               return false;
            }
 
 
            std::vector<bool> visited(V, false);
 
 
-           // Run DFS from the first non-isolated vertex
-           DFS(start_node, visited, *this);
+           // Run DFS from the first non-isolated vertex (iterative, no output)
+           TraversalScratch<Graph> scratch;
+           iterativeDFS(*this, start_node, visited, scratch);
 
 
            // Check if all non-isolated vertices were visited
@@ -227,95 +219,251 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
 
 
        void Graph::findEulerCircuit(std::ostream& out){
-          
+           
            if (!isEulerian()) {
                out << "The graph is not Eulerian." << std::endl;
                return;
            }
 
-
-           std::vector<std::vector<std::pair<int, int>>> tempAdj = adj; // Create a copy of the adjacency list
-           std::vector<int> circuit; // To store the Eulerian circuit
-           std::vector<int> stack; // Stack to hold the current path
-
-
            int currVertex = 0;
 
-
            // Start from the first vertex with edges
            for (int i = 0; i < V; ++i) {
-                   if (directed) {
-                       if (get_out_degree(i) > 0) {
-                           currVertex = i;
-                           break;
-                       }
-                   } else {
-                       if (degree(i) > 0) {
-                           currVertex = i;
-                           break;
-                       }
+                   if (get_out_degree(i) > 0) {
+                       currVertex = i;
+                       break;
                    }
                }
-               stack.push_back(currVertex);
 
+           std::vector<int> circuit; // To store the Eulerian circuit
+           hierholzer(currVertex, circuit);
 
+           // Print the Eulerian circuit
+           out << "Eulerian Circuit: ";
+           for (auto it = circuit.rbegin(); it != circuit.rend(); ++it) {
+               out << *it << " ";
+           }
+           out << std::endl;
+       }
 
 
-           while (!stack.empty()) {
-               if (tempAdj[currVertex].empty()) {
-                   // If no more neighbors, add to circuit
-                   circuit.push_back(currVertex);
-                   currVertex = stack.back();
-                   stack.pop_back();
-               } else {
-                   // Otherwise, continue traversing
-                   stack.push_back(currVertex);
-                   int nextVertex = tempAdj[currVertex].back().first;
-                   // Remove the edge from the graph
-                   tempAdj[currVertex].pop_back();
-                  
-                   // For undirected graph, remove the reverse edge as well
-                   if (!directed) {
-                       auto it = std::find_if(tempAdj[nextVertex].begin(), tempAdj[nextVertex].end(),
-                                      [&](const auto& pair) { return pair.first == currVertex; });
-                       if (it != tempAdj[nextVertex].end()) {
-                           tempAdj[nextVertex].erase(it);
-                       }
+       int Graph::eulerPathStart() const
+       {
+           int start = -1;
+
+           if (directed) {
+               // Exactly one vertex with out - in == 1 (start) and one with in - out == 1 (end)
+               int starts = 0, ends = 0;
+               for (int i = 0; i < V; ++i) {
+                   int diff = outDeg[i] - inDeg[i];
+                   if (diff == 0) continue;
+                   if (diff == 1 && starts++ == 0) start = i;
+                   else if (diff == -1 && ends++ == 0) continue;
+                   else return -1;
+               }
+               if (starts != 1 || ends != 1) return -1;
+           } else {
+               // Exactly two odd-degree vertices; the path runs from the first to the second
+               int odd = 0;
+               for (int i = 0; i < V; ++i) {
+                   if (outDeg[i] % 2 != 0 && odd++ == 0) start = i;
+               }
+               if (odd != 2) return -1;
+           }
 
+           std::vector<bool> visited(V, false);
+           TraversalScratch<Graph> scratch;
+           iterativeDFS(*this, start, visited, scratch);
 
-                   }
-                   currVertex = nextVertex;
+           // Every vertex that touches an edge must be reachable from the start
+           for (int i = 0; i < V; ++i) {
+               if (outDeg[i] + inDeg[i] > 0 && !visited[i]) {
+                   return -1;
                }
            }
+           return start;
+       }
 
 
-           // Print the Eulerian circuit
-           out << "Eulerian Circuit: ";
-           for (auto it = circuit.rbegin(); it != circuit.rend(); ++it) {
-           out << *it << " ";
+       bool Graph::hasEulerPath() const
+       {
+           return eulerPathStart() != -1;
+       }
+
+
+       void Graph::findEulerPath(std::ostream& out){
+
+           int start = eulerPathStart();
+           if (start == -1) {
+               out << "The graph has no Eulerian path." << std::endl;
+               return;
+           }
+
+           std::vector<int> path;
+           hierholzer(start, path);
+
+           out << "Eulerian Path: ";
+           for (auto it = path.rbegin(); it != path.rend(); ++it) {
+               out << *it << " ";
            }
            out << std::endl;
        }
-  
 
 
+       void Graph::hierholzer(int start, std::vector<int>& circuit) const
+       {
+           // Number the adjacency entries globally: adj[u][i] is half-edge off[u] + i
+           std::vector<int> off(V + 1, 0);
+           for (int u = 0; u < V; ++u) {
+               off[u + 1] = off[u] + static_cast<int>(adj[u].size());
+           }
+           const int H = off[V];
+
+           // Undirected edges are stored twice; twin[h] is the other copy so both share one ID.
+           // Pairing is O(V + E): bucket the u -> v (u < v) copies by v, then match them
+           // against the v -> u entries of adj[v] through a per-vertex slot table.
+           std::vector<int> twin;
+           if (!directed) {
+               twin.assign(H, -1);
+
+               std::vector<int> bucket(V + 1, 0);
+               for (int u = 0; u < V; ++u) {
+                   for (const auto& neighbor : adj[u]) {
+                       if (neighbor.first > u) ++bucket[neighbor.first + 1];
+                   }
+               }
+               for (int v = 0; v < V; ++v) {
+                   bucket[v + 1] += bucket[v];
+               }
 
+               std::vector<std::pair<int, int>> forward(bucket[V]); // {tail u, half-edge id}
+               std::vector<int> fill(bucket.begin(), bucket.end() - 1);
+               for (int u = 0; u < V; ++u) {
+                   for (int i = 0; i < static_cast<int>(adj[u].size()); ++i) {
+                       int v = adj[u][i].first;
+                       if (v > u) forward[fill[v]++] = {u, off[u] + i};
+                   }
+               }
 
-void DFS(int start_node, std::vector<bool>& visited, const Graph& graph) {
-   // Mark the current node as visited
-   visited[start_node] = true;
-   std::cout << start_node << " "; // Print the node
+               std::vector<int> slotOf(V, -1);
+               for (int v = 0; v < V; ++v) {
+                   for (int i = 0; i < static_cast<int>(adj[v].size()); ++i) {
+                       int u = adj[v][i].first;
+                       if (u < v) slotOf[u] = off[v] + i;
+                   }
+                   for (int k = bucket[v]; k < bucket[v + 1]; ++k) {
+                       int h = forward[k].second;
+                       int r = slotOf[forward[k].first];
+                       twin[h] = r;
+                       twin[r] = h;
+                   }
+               }
+           }
+
+           std::vector<bool> used(H, false); // One bit per half-edge; both copies are set together
+           std::vector<int> next(V); // Entries of adj[u] not yet examined are [0, next[u])
+           for (int u = 0; u < V; ++u) {
+               next[u] = static_cast<int>(adj[u].size()); // Consume from the back, like pop_back did
+           }
 
+           std::vector<int> stack; // Stack to hold the current path
+           int currVertex = start;
+           stack.push_back(currVertex);
+
+           while (!stack.empty()) {
+               int& k = next[currVertex];
+               while (k > 0 && used[off[currVertex] + k - 1]) {
+                   --k; // Skip entries already consumed from the other endpoint
+               }
 
-   // Iterate through all neighbors of the current node
-   for (std::pair<int,int> neighbor : graph.getNeighbors(start_node)) {
-       //  Recursively call DFS for unvisited neighbors
-       if (!visited[neighbor.first]) {
-           DFS(neighbor.first, visited, graph);
+               if (k == 0) {
+                   // If no more unused edges, add to circuit
+                   circuit.push_back(currVertex);
+                   currVertex = stack.back();
+                   stack.pop_back();
+               } else {
+                   // Otherwise, continue traversing
+                   stack.push_back(currVertex);
+                   --k;
+                   int h = off[currVertex] + k;
+                   used[h] = true;
+                   if (!directed) {
+                       used[twin[h]] = true; // Mark the reverse copy in O(1)
+                   }
+                   currVertex = adj[currVertex][k].first;
+               }
+           }
        }
-   }
-}
 
+  
 
 
+Graph Graph::fromEdges(int V, const Edge* edges, std::size_t count, bool directed,
+                       DuplicatePolicy policy, LoadReport* report) {
+    Graph g(V, directed);
+    LoadReport r;
+
+    auto valid = [&](const Edge& e, bool tally) {
+        if (e.u < 0 || e.u >= V || e.v < 0 || e.v >= V) { if (tally) ++r.outOfRange; return false; }
+        if (e.w < 0) { if (tally) ++r.negativeWeight; return false; }
+        if (e.u == e.v) { if (tally) ++r.selfLoops; return false; }
+        return true;
+    };
+
+    // Pass 1: histogram of half-edges per source (undirected edges are stored in both rows)
+    std::vector<std::size_t> start(V + 1, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!valid(edges[i], true)) continue;
+        ++start[edges[i].u + 1];
+        if (!directed) ++start[edges[i].v + 1];
+    }
+    for (int x = 0; x < V; ++x) start[x + 1] += start[x];
+
+    // Pass 2: stable scatter by source, so each row keeps input order
+    std::vector<std::pair<int,int>> half(start[V]);
+    std::vector<std::size_t> fill(start.begin(), start.end() - 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        const Edge& e = edges[i];
+        if (!valid(e, false)) continue;
+        half[fill[e.u]++] = {e.v, e.w};
+        if (!directed) half[fill[e.v]++] = {e.u, e.w};
+    }
+
+    // Pass 3: per row, the first occurrence of a target keeps its position; repeats only
+    // update its weight according to the policy. Both copies of an undirected edge see
+    // the same weight sequence, so they stay consistent.
+    std::vector<int> lastRow(V, -1); // Row in which the target was last seen
+    std::vector<int> slot(V, 0);     // Its position in that row
+    std::size_t duplicateHalves = 0, entries = 0;
+    for (int u = 0; u < V; ++u) {
+        std::vector<std::pair<int,int>>& row = g.adj[u];
+        row.reserve(start[u + 1] - start[u]);
+        for (std::size_t k = start[u]; k < start[u + 1]; ++k) {
+            int v = half[k].first, w = half[k].second;
+            if (lastRow[v] == u) {
+                ++duplicateHalves;
+                int& kept = row[slot[v]].second;
+                if (policy == DuplicatePolicy::KeepLast || (policy == DuplicatePolicy::KeepMinWeight && w < kept))
+                    kept = w;
+                continue;
+            }
+            lastRow[v] = u;
+            slot[v] = static_cast<int>(row.size());
+            row.push_back({v, w});
+            ++g.inDeg[v];
+        }
+        g.outDeg[u] = static_cast<int>(row.size());
+        entries += row.size();
+    }
+
+    r.duplicates = directed ? duplicateHalves : duplicateHalves / 2;
+    r.accepted = directed ? entries : entries / 2;
+
+    if (report) *report = r;
+    return g;
+}
 
+Graph Graph::fromEdges(int V, const std::vector<Edge>& edges, bool directed,
+                       DuplicatePolicy policy, LoadReport* report) {
+    return fromEdges(V, edges.data(), edges.size(), directed, policy, report);
+}
@@ -8,6 +8,7 @@
 #include <vector>
 #include <iostream>
 #include <utility> // For std::pair
+#include <cstddef>
 
 
 
@@ -17,12 +18,55 @@ class Graph
    int V; // Number of vertices
    bool directed = false; // Directed or undirected graph                                               
    std::vector<std::vector<std::pair<int,int>>> adj; // Adjacency list representation
+   std::vector<int> inDeg; // In-degree per vertex, maintained by addEdge
+   std::vector<int> outDeg; // Out-degree per vertex, maintained by addEdge
+
+
+   // Hierholzer over half-edge IDs; appends the walk from start in reverse order
+   void hierholzer(int start, std::vector<int>& circuit) const;
+
+
+   // Start vertex of an Euler path that is not a circuit, or -1 if there is none
+   int eulerPathStart() const;
 
 
    public:
+       struct Edge
+       {
+           int u, v, w;
+       };
+
+
+       // What fromEdges does when the same edge appears more than once
+       enum class DuplicatePolicy { KeepFirst, KeepLast, KeepMinWeight };
+
+
+       // Per-reason rejection counts, reported once instead of one std::cerr line per edge
+       struct LoadReport
+       {
+           std::size_t accepted = 0;
+           std::size_t outOfRange = 0;
+           std::size_t negativeWeight = 0;
+           std::size_t selfLoops = 0;
+           std::size_t duplicates = 0;
+
+           std::size_t rejected() const { return outOfRange + negativeWeight + selfLoops + duplicates; }
+       };
+
+
        Graph(int V, bool directed);
 
 
+       // Bulk build: counting (radix) sort by source, then one pass dropping duplicates and
+       // self-loops. Neighbor order matches calling addEdge on the edges in input order.
+       static Graph fromEdges(int V, const Edge* edges, std::size_t count, bool directed,
+                              DuplicatePolicy policy = DuplicatePolicy::KeepFirst, LoadReport* report = nullptr);
+
+
+       static Graph fromEdges(int V, const std::vector<Edge>& edges, bool directed,
+                              DuplicatePolicy policy = DuplicatePolicy::KeepFirst, LoadReport* report = nullptr);
+
+
        void addEdge(int u, int v, int w = 0);
 
 
@@ -48,12 +92,21 @@ class Graph
        int get_out_degree(int v) const;
 
 
+       bool hasEulerianDegrees() const; // Single O(V) pass: in == out (directed) or all even (undirected)
+
+
        bool isEulerian() const;
 
 
        void findEulerCircuit(std::ostream& out);
 
 
+       bool hasEulerPath() const; // Exactly two odd (or unbalanced) vertices and connected
+
+
+       void findEulerPath(std::ostream& out);
+
+
       
 };
 #endif
@@ -0,0 +1,242 @@
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "RequestParser.hpp"
+
+
+static bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+static const char* skipBlanks(const char* p, const char* end)
+{
+    while (p < end && isBlank(*p)) ++p;
+    return p;
+}
+
+static std::string_view trim(std::string_view text)
+{
+    const char* first = skipBlanks(text.data(), text.data() + text.size());
+    const char* last = text.data() + text.size();
+    while (last > first && isBlank(last[-1])) --last;
+    return std::string_view(first, last - first);
+}
+
+// Read whitespace-separated integers from a line with std::from_chars, at most max of them.
+// Returns the number read, or -1 on a token that is not an integer (or one too many).
+template <typename F>
+static int scanInts(std::string_view text, int max, F onValue)
+{
+    const char* p = skipBlanks(text.data(), text.data() + text.size());
+    const char* end = text.data() + text.size();
+    int count = 0;
+    while (p < end) {
+        int x = 0;
+        std::from_chars_result r = std::from_chars(p, end, x);
+        if (r.ec != std::errc() || (r.ptr < end && !isBlank(*r.ptr)) || count == max) return -1;
+        onValue(count++, x);
+        p = skipBlanks(r.ptr, end);
+    }
+    return count;
+}
+
+bool RequestStream::fail(std::string message)
+{
+    err = std::move(message);
+    state = State::Failed;
+    carry.clear();
+    return false;
+}
+
+bool RequestStream::feed(const char* data, std::size_t n)
+{
+    received += n;
+    const char* p = data;
+    const char* end = data + n;
+
+    while (p < end) {
+        if (state == State::Failed) return false;
+        if (state == State::BinaryHeader || state == State::BinaryRecords)
+            return binary(p, static_cast<std::size_t>(end - p));
+
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        if (!nl) { // The line continues in the next chunk
+            carry.append(p, end);
+            return true;
+        }
+        if (carry.empty()) {
+            if (!line(std::string_view(p, nl - p))) return false; // Parsed straight from the chunk
+        } else {
+            carry.append(p, nl);
+            std::string pending;
+            pending.swap(carry);
+            if (!line(pending)) return false;
+        }
+        p = nl + 1;
+    }
+    return state != State::Failed;
+}
+
+bool RequestStream::finish()
+{
+    if (state == State::Failed) return false;
+    if (!carry.empty() && state != State::BinaryHeader && state != State::BinaryRecords) {
+        std::string last; // No trailing newline
+        last.swap(carry);
+        if (!line(last)) return false;
+    }
+
+    switch (state) {
+        case State::FirstLine:
+        case State::VertexLine:
+            return fail("vertex count must be a positive number");
+        case State::TypeLine:
+            return fail("graph type must be 'directed' or 'undirected'");
+        case State::MatrixRows:
+            if (row != out.numVertices)
+                return fail("expected " + std::to_string(out.numVertices) + " matrix rows, got " + std::to_string(row));
+            return true;
+        case State::BinaryHeader:
+            return fail("binary header is truncated");
+        case State::BinaryRecords:
+            if (!carry.empty() || out.edges.size() != expectedEdges)
+                return fail("expected " + std::to_string(expectedEdges) + " edge records, got " +
+                            std::to_string(out.edges.size()) + " and " + std::to_string(carry.size()) + " extra bytes");
+            return true;
+        default:
+            return true;
+    }
+}
+
+bool RequestStream::line(std::string_view text)
+{
+    switch (state) {
+        case State::FirstLine: {
+            std::string_view first = trim(text);
+            if (first == kEdgeListBinaryTag) {
+                out.format = RequestFormat::EdgeListBinary;
+                state = State::BinaryHeader;
+                return true;
+            }
+            if (first == kEdgeListTextTag) {
+                out.format = RequestFormat::EdgeListText;
+                state = State::VertexLine;
+                return true;
+            }
+            out.format = RequestFormat::Matrix; // The first line already is the vertex count
+            state = State::VertexLine;
+            return line(text);
+        }
+
+        case State::VertexLine: {
+            // Number of vertices (anything after the number is ignored)
+            std::string_view t = trim(text);
+            int V = 0;
+            std::from_chars_result r = std::from_chars(t.data(), t.data() + t.size(), V);
+            if (r.ec != std::errc() || V <= 0) return fail("vertex count must be a positive number");
+            if (out.format != RequestFormat::Matrix && V > kMaxEdgeListVertices)
+                return fail("edge lists are limited to " + std::to_string(kMaxEdgeListVertices) + " vertices");
+            out.numVertices = V;
+            state = State::TypeLine;
+            return true;
+        }
+
+        case State::TypeLine: {
+            std::string_view t = trim(text);
+            if (t == "directed") out.directed = true;
+            else if (t == "undirected") out.directed = false;
+            else return fail("graph type must be 'directed' or 'undirected'");
+            state = out.format == RequestFormat::Matrix ? State::MatrixRows : State::EdgeLines;
+            return true;
+        }
+
+        case State::MatrixRows: {
+            // V integers per non-empty line, emitted straight into the edge list
+            if (trim(text).empty()) return true;
+            const int V = out.numVertices;
+            if (row == V) return fail("more than " + std::to_string(V) + " matrix rows");
+            int cols = scanInts(text, V, [&](int col, int w) {
+                if (w > -1) out.edges.push_back({row, col, w}); // There's an edge with weight w
+            });
+            if (cols < 0) return fail("bad value in row " + std::to_string(row));
+            if (cols != V)
+                return fail("row " + std::to_string(row) + " has " + std::to_string(cols) + " values, expected " + std::to_string(V));
+            ++row;
+            return true;
+        }
+
+        case State::EdgeLines: {
+            // One edge per non-empty line: u v [w]
+            if (trim(text).empty()) return true;
+            int values[3] = {0, 0, 0};
+            int count = scanInts(text, 3, [&](int i, int x) { values[i] = x; });
+            if (count < 2) return fail("bad edge #" + std::to_string(out.edges.size() + 1) + " (expected: u v [w])");
+            out.edges.push_back({values[0], values[1], values[2]});
+            return true;
+        }
+
+        default:
+            return state != State::Failed;
+    }
+}
+
+bool RequestStream::binary(const char* data, std::size_t n)
+{
+    if (state == State::BinaryHeader) {
+        std::size_t take = std::min(n, sizeof(EdgeListBinaryHeader) - carry.size());
+        carry.append(data, take);
+        data += take;
+        n -= take;
+        if (carry.size() < sizeof(EdgeListBinaryHeader)) return true;
+
+        EdgeListBinaryHeader h;
+        std::memcpy(&h, carry.data(), sizeof(h));
+        carry.clear();
+        if (h.numVertices == 0) return fail("vertex count must be a positive number");
+        if (h.numVertices > static_cast<std::uint32_t>(kMaxEdgeListVertices))
+            return fail("edge lists are limited to " + std::to_string(kMaxEdgeListVertices) + " vertices");
+        out.numVertices = static_cast<int>(h.numVertices);
+        out.directed = (h.flags & EdgeListBinaryHeader::kDirected) != 0;
+        expectedEdges = h.numEdges;
+        state = State::BinaryRecords;
+    }
+
+    const std::size_t record = sizeof(Graph::Edge);
+    if (!carry.empty()) { // Complete the record split across chunks
+        std::size_t take = std::min(n, record - carry.size());
+        carry.append(data, take);
+        data += take;
+        n -= take;
+        if (carry.size() < record) return true;
+        if (out.edges.size() == expectedEdges)
+            return fail("more than the " + std::to_string(expectedEdges) + " announced edge records");
+        Graph::Edge e;
+        std::memcpy(&e, carry.data(), record);
+        out.edges.push_back(e);
+        carry.clear();
+    }
+
+    // Whole records go straight from the chunk into the edge list (they have Graph::Edge's layout)
+    std::size_t whole = n / record;
+    if (whole > expectedEdges - out.edges.size())
+        return fail("more than the " + std::to_string(expectedEdges) + " announced edge records");
+    std::size_t at = out.edges.size();
+    out.edges.resize(at + whole);
+    if (whole > 0) std::memcpy(out.edges.data() + at, data, whole * record);
+    carry.assign(data + whole * record, n - whole * record);
+    return true;
+}
+
+bool parseRequest(const char* begin, const char* end, GraphRequest& out, std::string& err)
+{
+    RequestStream stream;
+    bool ok = stream.feed(begin, static_cast<std::size_t>(end - begin)) && stream.finish();
+    out = std::move(stream.request());
+    err = stream.error();
+    return ok;
+}
@@ -0,0 +1,117 @@
+#ifndef REQUEST_PARSER_HPP
+#define REQUEST_PARSER_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+#include "Graph.hpp"
+
+// Request formats, told apart by the first line (see RequestStream)
+enum class RequestFormat { Matrix, EdgeListText, EdgeListBinary };
+
+inline constexpr const char* kEdgeListTextTag = "EDGELIST";
+inline constexpr const char* kEdgeListBinaryTag = "EDGELIST-BIN";
+
+// Largest vertex count an edge list may announce. The graph allocates per-vertex
+// state up front, so without a cap a few bytes could ask for gigabytes.
+// (A matrix is bounded by its own V x V cells.)
+inline constexpr int kMaxEdgeListVertices = 1 << 20;
+
+// Follows the "EDGELIST-BIN\n" line, then 'numEdges' records of {int32 u, v, w}.
+// Native (little-endian) byte order; the records have Graph::Edge's layout.
+struct EdgeListBinaryHeader
+{
+    std::uint32_t numVertices;
+    std::uint32_t flags;    // Bit 0: directed
+    std::uint64_t numEdges;
+
+    static constexpr std::uint32_t kDirected = 1;
+};
+
+static_assert(sizeof(EdgeListBinaryHeader) == 16, "EdgeListBinaryHeader must stay 16 bytes");
+static_assert(sizeof(Graph::Edge) == 12, "binary edge records are three int32 values");
+
+/**
+ * @brief A graph request as received by the server, before it is built.
+ *
+ * edges is ready for Graph::fromEdges(KeepFirst). For a matrix it holds one
+ * entry per non-negative cell in row-major order, so the result equals the
+ * old addEdge loop (the mirrored cell of an undirected matrix is dropped as a
+ * duplicate). Edge lists are passed through in the order they were sent.
+ */
+struct GraphRequest
+{
+    RequestFormat format = RequestFormat::Matrix;
+    int numVertices = 0;
+    bool directed = false;
+    std::vector<Graph::Edge> edges;
+};
+
+/**
+ * @brief Chunk-driven request parser: feed() each recv buffer as it arrives.
+ *
+ * A small state machine (first line -> header lines -> rows / edges / binary
+ * records) builds the GraphRequest while the rest of the request is still in
+ * flight. Only an incomplete trailing line (or binary record) is carried from
+ * one chunk to the next, so the raw request text is never held in full.
+ *
+ * Formats, told apart by the first line:
+ *
+ *   <V>                      dense adjacency matrix
+ *   directed | undirected
+ *   V lines of V integers    (-1 = no edge, otherwise the weight; empty lines are skipped)
+ *
+ *   EDGELIST                 sparse edge list, text: O(E) bytes instead of O(V^2)
+ *   <V>
+ *   directed | undirected
+ *   one edge per line: u v [w]   (w defaults to 0; undirected edges are sent once)
+ *
+ *   EDGELIST-BIN             sparse edge list, binary: an EdgeListBinaryHeader,
+ *                            then exactly numEdges 12-byte records
+ *
+ * Edge lists announcing more than kMaxEdgeListVertices vertices are rejected.
+ * Vertex ranges, self-loops and duplicates in edge lists are left to
+ * Graph::fromEdges and show up in its LoadReport.
+ */
+class RequestStream
+{
+    public:
+        // Consume the next chunk. Returns false once the request is known to be malformed;
+        // later chunks are then ignored, so the caller can keep draining the socket.
+        bool feed(const char* data, std::size_t n);
+
+        // End of input: flush the last line and check that the request is complete
+        bool finish();
+
+        bool failed() const { return state == State::Failed; }
+        const std::string& error() const { return err; }
+        std::size_t bytesReceived() const { return received; }
+
+        GraphRequest& request() { return out; }
+
+    private:
+        enum class State { FirstLine, VertexLine, TypeLine, MatrixRows, EdgeLines, BinaryHeader, BinaryRecords, Failed };
+
+        State state = State::FirstLine;
+        GraphRequest out;
+        std::string err;
+        std::string carry;        // Incomplete line or binary record from the previous chunk
+        int row = 0;              // Matrix rows seen so far
+        std::uint64_t expectedEdges = 0; // Binary: records announced by the header
+        std::size_t received = 0;
+
+        bool line(std::string_view text);  // One complete text line (without '\n')
+        bool binary(const char* data, std::size_t n);
+        bool fail(std::string message);
+};
+
+/**
+ * @brief Parse a complete request held in memory (feed + finish on a RequestStream).
+ * @return false with a message in err if the request is malformed.
+ */
+bool parseRequest(const char* begin, const char* end, GraphRequest& out, std::string& err);
+
+#endif
@@ -20,6 +20,7 @@
 
 
 #include "Graph.hpp"
+#include "RequestParser.hpp" // Wire-format tags and the binary edge-list header
 #define STDIN_FD 0
 static const char* SOCKET_PATH = "mysocket";
 static const size_t MAXDATASIZE = 1024; // גודל קריאה בכל recv
@@ -80,6 +81,42 @@ static std::string toAdjacencyMatrixText(const Graph& g) {
     return out.str();
 }
 
+// Sparse text request: each edge once (u < v when undirected), O(E) bytes
+static std::string toEdgeListText(const Graph& g) {
+    std::ostringstream out;
+    out << kEdgeListTextTag << '\n';
+    out << g.getNumVertices() << '\n';
+    out << (g.isDirected() ? "directed" : "undirected") << '\n';
+    for (int u = 0; u < g.getNumVertices(); ++u) {
+        for (std::pair<int,int> v : g.getNeighbors(u)) {
+            if (!g.isDirected() && v.first < u) continue; // Sent from the other end
+            out << u << ' ' << v.first << ' ' << v.second << '\n';
+        }
+    }
+    return out.str();
+}
+
+// Compact binary request: tag line, EdgeListBinaryHeader, then 12-byte {u, v, w} records
+static std::string toEdgeListBinary(const Graph& g) {
+    std::vector<Graph::Edge> edges;
+    for (int u = 0; u < g.getNumVertices(); ++u) {
+        for (std::pair<int,int> v : g.getNeighbors(u)) {
+            if (!g.isDirected() && v.first < u) continue;
+            edges.push_back({u, v.first, v.second});
+        }
+    }
+
+    EdgeListBinaryHeader h{};
+    h.numVertices = static_cast<std::uint32_t>(g.getNumVertices());
+    h.flags = g.isDirected() ? EdgeListBinaryHeader::kDirected : 0;
+    h.numEdges = edges.size();
+
+    std::string out = std::string(kEdgeListBinaryTag) + '\n';
+    out.append(reinterpret_cast<const char*>(&h), sizeof(h));
+    out.append(reinterpret_cast<const char*>(edges.data()), edges.size() * sizeof(Graph::Edge));
+    return out;
+}
+
 // ---------- שליחה מלאה על גבי סוקט ----------
 static bool send_all(int fd, const char* buf, size_t len) {
     size_t sent = 0;
@@ -103,8 +140,9 @@ int main(int argc, char* argv[]) {
     int seed;
     int opt;
     bool directed = false; // Default to not directed graph
+    std::string format = "matrix"; // Wire format: matrix | edges | binary
 
-    while ((opt = getopt(argc, argv, "v:e:s:d")) != -1) {
+    while ((opt = getopt(argc, argv, "v:e:s:df:")) != -1) {
         switch (opt) {
             case 'v':
                 V = std::stoi(optarg);
@@ -118,8 +156,11 @@ int main(int argc, char* argv[]) {
             case 'd':
                 directed = true;
                 break;
+            case 'f':
+                format = optarg;
+                break;
             case '?':
-                if (optopt == 'v' || optopt == 'e' || optopt == 's') {
+                if (optopt == 'v' || optopt == 'e' || optopt == 's' || optopt == 'f') {
                     std::cerr << "Option -" << static_cast<char>(optopt) << " requires an argument." << std::endl;
                 } else {
                     std::cerr << "Unknown option `-" << static_cast<char>(optopt) << "`." << std::endl;
@@ -130,6 +171,10 @@ int main(int argc, char* argv[]) {
         }
     }
 
+    if (format != "matrix" && format != "edges" && format != "binary") {
+        std::cerr << "Error: Format (-f) must be matrix, edges or binary." << std::endl;
+        return 1;
+    }
     if (V <= 0) {
         std::cerr << "Error: Number of vertices must be positive." << std::endl;
         return 1;
@@ -153,8 +198,10 @@ int main(int argc, char* argv[]) {
     // Generate the random graph
     Graph g = generateRandomGraph(V, E, seed, directed);
 
-    // Convert to adjacency matrix text
-    std::string matrixText = toAdjacencyMatrixText(g);
+    // Serialize in the requested wire format (edge lists cost O(E) instead of O(V^2))
+    std::string matrixText = format == "edges"  ? toEdgeListText(g)
+                           : format == "binary" ? toEdgeListBinary(g)
+                                                : toAdjacencyMatrixText(g);
 
     // חיבור ל-UDS
     int sockfd = ::socket(AF_UNIX, SOCK_STREAM, 0);
@@ -171,7 +218,7 @@ int main(int argc, char* argv[]) {
     }
 
     // מדפיסים מה נשלח
-    std::cout << "=== Sending adjacency matrix to server ===\n";
+    std::cout << "=== Sending " << (format == "matrix" ? "adjacency matrix" : "edge list") << " to server ===\n";
              // << matrixText << std::flush;
 
     // שולחים את המטריצה
@@ -1,8 +1,9 @@
 /*
 ** server_uds.cpp -- UDS server with select()
-** קלט: מטריצת שכנויות טקסטואלית (שורות, רווחים, \n)
+** קלט: מטריצת שכנויות טקסטואלית (שורות, רווחים, \n), או רשימת קשתות EDGELIST / EDGELIST-BIN
 ** פלט: "EULERIAN: YES\n" + פלט findEulerCircuit(os) או "EULERIAN: NO\n"
-** בנוסף: השרת מדפיס למסך את המטריצה שקיבל ואת התשובה שהוא שולח
+** בנוסף: השרת מדפיס למסך סיכום של הבקשה שקיבל ואת התשובה שהוא שולח
+** הבקשה מפוענחת תוך כדי קבלה (RequestStream), בלי לשמור את כל הטקסט הגולמי
 */
 
 
@@ -13,6 +14,8 @@
 #include <vector>
 #include <sstream>
 #include <iostream>
+#include <map>
+#include <exception>
 
 
 #include <unistd.h>
@@ -23,6 +26,7 @@
 
 
 #include "Graph.hpp"
+#include "RequestParser.hpp"
 
 
 static const char* SOCKET_PATH = "mysocket"; /*
@@ -102,6 +106,10 @@ FD_ZERO(&read_fds);
    std::printf("Server is listening on UNIX socket: %s\n", SOCKET_PATH);
 
 
+   // Per-client parser state while a request is still arriving
+   std::map<int, RequestStream> streams;
+
+
    for (;;) {
        read_fds = master;
        if (::select(fdmax + 1, &read_fds, nullptr, nullptr, nullptr) == -1) {
@@ -124,114 +132,78 @@ FD_ZERO(&read_fds);
 
 
            } else {
-               // 1) Receive the request from the client (stop on EOF)
-               std::string request;
-               char rbuf[4096];
-               for (;;) {
-                   ssize_t n = ::recv(i, rbuf, sizeof(rbuf), 0);
-                   if (n == 0) break;                  // EOF
-                   if (n < 0) {
-                       if (errno == EINTR) continue;
-                       perror("recv"); break;
-                   }
-                   request.append(rbuf, rbuf + n);
-               }
-               if (request.empty()) {
-                   ::close(i); FD_CLR(i, &master);
-                   std::printf("Empty request. Closed socket %d\n", i);
+               // 1) Receive whatever has arrived and parse it right away; the request is
+               //    never buffered whole, only its partial last line is carried over
+               RequestStream& stream = streams[i];
+               static char rbuf[64 * 1024];
+               ssize_t n = ::recv(i, rbuf, sizeof(rbuf), 0);
+               if (n < 0) {
+                   if (errno == EINTR) continue;
+                   perror("recv");
+                   streams.erase(i); ::close(i); FD_CLR(i, &master);
                    continue;
                }
-
-
-               // 2) Print what was received, for debugging
-               std::printf("=== Received adjacency matrix (text) ===\n%.*s\n",
-                           int(request.size()), request.c_str());
-              
-               std::istringstream iss(request);       
-               std::string line;  
-              
-               //Reading the first line: number of vertices
-               int num_vertices = 0;
-               if (std::getline(iss, line)) {
-                   try {
-                       num_vertices = std::stoi(line);
-                   } catch (const std::exception& e) {
-                       // Error parsing number of vertices 
-                       std::printf("Error parsing number of vertices: %s\n", e.what());
-                       //
-                       continue;
-                   }
+               if (n > 0) {
+                   // A malformed request stops being parsed, but is drained until EOF so the client gets the answer
+                   stream.feed(rbuf, static_cast<size_t>(n));
+                   continue;
                }
 
 
-               // Reading the second line: directed or undirected
-               std::string graph_type;
-               bool is_directed = false;
-
-
-               if (std::getline(iss, line)) {
-                   if (line == "directed") {
-                       is_directed = true; // Directed graph
-
-
-                   } else if (line == "undirected") {
-                       is_directed = false;
-                   }
+               // EOF: the client finished sending
+               if (stream.bytesReceived() == 0) {
+                   streams.erase(i); ::close(i); FD_CLR(i, &master);
+                   std::printf("Empty request. Closed socket %d\n", i);
+                   continue;
                }
 
 
-               // 3) Read the adjacency matrix into a 2D vector
-               std::vector<std::vector<int>> adj;
-               {
-
+               // 2) Complete the parse; the first line picked the format
+               bool valid = stream.finish();
+               GraphRequest& parsed = stream.request();
+               const std::string& err = stream.error();
 
-                   std::string line;
 
-
-                   // Read each line and parse integers into the adjacency matrix
-                   while (std::getline(iss, line)) {
-                       if (line.empty()) continue;
-                       std::istringstream lss(line); // Line String Stream
-                       std::vector<int> row; // To hold the current row
-                       int v; // Variable to hold each integer
-                       while (lss >> v) row.push_back(v);
-                       if (!row.empty()) adj.push_back(row);
-                   }
-               }
-
-
-               bool square = !adj.empty();
-               for (const auto& row : adj) {
-                   if (row.size() != adj.size()) { square = false; break; }
-               }
+               // 3) Print what was received, for debugging
+               std::printf("=== Received %s (%s, %zu bytes, %d vertices, %zu edges) ===\n",
+                           parsed.format == RequestFormat::Matrix ? "adjacency matrix" : "edge list",
+                           parsed.format == RequestFormat::EdgeListBinary ? "binary" : "text",
+                           stream.bytesReceived(), parsed.numVertices, parsed.edges.size());
 
 
+               const std::string invalid = parsed.format == RequestFormat::Matrix ? "EULERIAN: NO\nInvalid adjacency matrix.\n"
+                                                                                  : "EULERIAN: NO\nInvalid edge list.\n";
                std::string response;
-               if (!square) {
-                   response = "EULERIAN: NO\nInvalid adjacency matrix.\n";
+               if (!valid) {
+                   std::printf("Invalid request: %s\n", err.c_str());
+                   response = invalid;
                } else {
-                   // 4) Build the graph from the adjacency matrix
-              
-                   Graph graph(num_vertices, is_directed);
-                   for (int r = 0; r < num_vertices; ++r) { // For each row
-                       for (int c = 0; c < num_vertices; ++c) { // For each column
-                           if (adj[r][c] > -1 && !graph.isEdgeConnected(r, c)) { // There's an edge
-                               graph.addEdge(r, c, adj[r][c]); // Add edge with weight (adj[r][c])
-                           }
+                   try {
+                       // 4) Bulk build; the mirrored cell of an undirected matrix (or a repeated edge) is a duplicate
+                       Graph::LoadReport report;
+                       Graph graph = Graph::fromEdges(parsed.numVertices, parsed.edges, parsed.directed,
+                                                      Graph::DuplicatePolicy::KeepFirst, &report);
+                       if (report.rejected() > report.duplicates) {
+                           std::printf("Rejected edges: %zu self-loops, %zu negative weights, %zu out of range\n",
+                                       report.selfLoops, report.negativeWeight, report.outOfRange);
                        }
-                   }
 
 
-                   // 5) Check if the graph is Eulerian and find the Eulerian circuit if it is
-                   std::ostringstream oss;
-                   graph.findEulerCircuit(oss); // Pass the ostringstream to capture output
-                   std::string printed = oss.str();
+                       // 5) Check if the graph is Eulerian and find the Eulerian circuit if it is
+                       std::ostringstream oss;
+                       graph.findEulerCircuit(oss); // Pass the ostringstream to capture output
+                       std::string printed = oss.str();
 
 
-                   if (printed == "The graph is not Eulerian.\n") {
-                       response = "EULERIAN: NO\n";
-                   } else {
-                       response = "EULERIAN: YES\n"  + printed;
+                       if (printed == "The graph is not Eulerian.\n") {
+                           response = "EULERIAN: NO\n";
+                       } else {
+                           response = "EULERIAN: YES\n"  + printed;
+                       }
+                   } catch (const std::exception& ex) {
+                       // e.g. bad_alloc: one bad request must not take the server down
+                       std::printf("Cannot build the graph: %s\n", ex.what());
+                       response = invalid;
                    }
                }
 
@@ -246,7 +218,7 @@ FD_ZERO(&read_fds);
                }
 
 
-               ::close(i); FD_CLR(i, &master);
+               streams.erase(i); ::close(i); FD_CLR(i, &master);
                std::printf("Finished processing client on socket %d\n", i);
            }
        }
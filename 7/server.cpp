@@ -18,6 +18,7 @@
 #include "Factory.hpp"   // AlgorithmFactory::createAlgorithm
 
 static const char* SOCKET_PATH = "mysocket";
+static const size_t MAX_REQUEST = 64 * 1024; // a request is one command line, never a graph
 
 std::string graphToString(const Graph& g) {
     std::ostringstream os;
@@ -201,6 +202,7 @@ int main() {
                         break;
                     }
                     request.append(rbuf, rbuf + n);
+                    if (request.size() > MAX_REQUEST) break; // stop buffering a runaway request
                 }
 
                 if (request.empty()) {
@@ -213,7 +215,9 @@ int main() {
                 std::printf("Received request:\n%.*s\n",
                             int(request.size()), request.c_str());
 
-                std::string response = handle_request_text(request);
+                std::string response = request.size() > MAX_REQUEST
+                    ? "ERROR: request longer than " + std::to_string(MAX_REQUEST) + " bytes\n"
+                    : handle_request_text(request);
 
                 std::printf("Response to client\n%.*s",
                             int(response.size()), response.c_str());
@@ -5,13 +5,23 @@
 
 class Algorithms{
     public:
-    ~Algorithms()=default;
+    virtual ~Algorithms()=default;
     /**
      * @brief Activate the algorithm on the graph.
+     * The graph is never modified: an algorithm that needs to change it works on its
+     * own copy (Graph copies are copy-on-write, so this costs nothing until it writes).
      * @param g The graph
      * @return A string containing the result of the algorithm.
      */
-    virtual std::string run(Graph& g)=0;
+    virtual std::string run(const Graph& g)=0;
+
+    /**
+     * @brief Activate the algorithm on a graph other threads are using at the same time.
+     * Safe because run() only reads g; see run().
+     * @param g The shared graph, never modified
+     * @return A string containing the result of the algorithm.
+     */
+    std::string runShared(const Graph& g) { return run(g); }
 };
 
 #endif
\ No newline at end of file
@@ -10,7 +10,13 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
 
 
 
-        Graph::Graph(int V, bool directed) : V(V), adj(V), directed(directed) {}
+        Graph::Graph(int V, bool directed) : V(V), directed(directed), adj(std::make_shared<AdjacencyList>(V)) {}
+
+        void Graph::detach()
+            {
+                if (adj.use_count() > 1)
+                    adj = std::make_shared<AdjacencyList>(*adj);
+            }
 
         void Graph::addEdge(int u, int v, int w) // Add edge from u to v
             {
@@ -36,10 +42,11 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                     return;
                 }
 
-                adj[u].push_back({v, w}); // Add edge from u to v
+                detach(); // Other copies keep the old lists
+                (*adj)[u].push_back({v, w}); // Add edge from u to v
                 
                 if(!directed){
-                    adj[v].push_back({u, w});  // For undirected graph
+                    (*adj)[v].push_back({u, w});  // For undirected graph
                 }
             
             }
@@ -53,7 +60,7 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                     static const std::vector<std::pair<int, int>> empty; // Return an empty vector on error
                     return empty;
                 }
-                return adj[v];
+                return (*adj)[v];
             }
 
         int Graph::getNumVertices() const
@@ -74,7 +81,7 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                     return false;
                 }
 
-                for (std::pair neighbor : adj[u])
+                for (std::pair neighbor : (*adj)[u])
                 {
                     if (neighbor.first == v)
                         return true;
@@ -88,7 +95,7 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                 for (int i = 0; i < V; ++i)
                 {
                     std::cout << "Vertex " << i << ":";
-                    for (std::pair<int,int> neighbor : adj[i])
+                    for (std::pair<int,int> neighbor : (*adj)[i])
                     {
                         std::cout << " " << neighbor.first << "(weight " << neighbor.second << ")";
                     }
@@ -111,7 +118,7 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                     return in_deg + out_deg; // Total degree is sum of in-degree and out-degree
                 }
 
-                return adj[v].size(); // Degree in not directed graph is simply the size of the adjacency list
+                return (*adj)[v].size(); // Degree in not directed graph is simply the size of the adjacency list
             }
         
         int Graph::get_in_degree(int v) const
@@ -125,7 +132,7 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
             int in_deg = 0;
             for (int i = 0; i < V; ++i) // Iterate through all vertices
             {
-                for (const auto& neighbor : adj[i]) // Check their adjacency lists
+                for (const auto& neighbor : (*adj)[i]) // Check their adjacency lists
                 {
                     if (neighbor.first == v) // If there's an edge to vertex v
                     {
@@ -143,7 +150,7 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                 std::cerr << "Error: Vertex out of bounds (out_degree)" << std::endl;
                 return -1;
             }
-            return adj[v].size(); // Out-degree is simply the size of the adjacency list
+            return (*adj)[v].size(); // Out-degree is simply the size of the adjacency list
         }
         
         bool Graph::isEulerian() const
@@ -208,7 +215,7 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                 return;
             }
 
-            std::vector<std::vector<std::pair<int, int>>> tempAdj = adj; // Create a copy of the adjacency list
+            std::vector<std::vector<std::pair<int, int>>> tempAdj = *adj; // Create a copy of the adjacency list
             std::vector<int> circuit; // To store the Eulerian circuit
             std::vector<int> stack; // Stack to hold the current path
 
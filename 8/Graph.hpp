@@ -5,13 +5,20 @@
 #include <vector>
 #include <iostream>
 #include <utility> // For std::pair
+#include <memory>
 
 
+// Copies share the adjacency lists until one of them calls addEdge (copy-on-write),
+// so copying a Graph is O(1) and shared copies may be read from several threads.
 class Graph
 {
+    using AdjacencyList = std::vector<std::vector<std::pair<int,int>>>;
+
     int V; // Number of vertices
     bool directed = false; // Directed or undirected graph												  
-    std::vector<std::vector<std::pair<int,int>>> adj; // Adjacency list representation
+    std::shared_ptr<AdjacencyList> adj; // Adjacency list representation, shared with copies
+
+    void detach(); // Take a private copy of adj if another Graph shares it
 
     public:
         Graph(int V, bool directed);
@@ -61,7 +61,7 @@ private:
     }
 
 public:
-    std::string run(Graph& g) override { // Entry point defined by the Algorithms interface
+    std::string run(const Graph& g) override { // Entry point defined by the Algorithms interface
         int V = g.getNumVertices();     // Get vertex count
         
         if (V == 0) {                   // Handle empty graph edge-case
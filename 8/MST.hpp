@@ -50,7 +50,7 @@ private:
     };
 
 public:
-    std::string run(Graph& g) override {
+    std::string run(const Graph& g) override {
         if (g.isDirected()) {
             return "ERROR: MST algorithm works only on undirected graphs\n";
         }
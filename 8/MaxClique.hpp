@@ -89,7 +89,7 @@ private:
     }
 
 public:
-    std::string run(Graph& g) override {
+    std::string run(const Graph& g) override {
         if (g.isDirected()) {
             return "ERROR: Max Clique algorithm works only on undirected graphs\n";
         }
@@ -36,7 +36,7 @@ private:
     }
 
 public:
-    std::string run(Graph& g) override {
+    std::string run(const Graph& g) override {
         if (!g.isDirected()) {
             return "ERROR: SCC algorithm works only on directed graphs\n";
         }
@@ -20,6 +20,7 @@
 #include "Factory.hpp"   // AlgorithmFactory::createAlgorithm
 #define SOCKET_PATH "mysocket"
 #define BACKLOG 64
+#define MAX_REQUEST (64 * 1024) // a request is one command line, never a graph
 #define NUM_THREADS 8
 
 // ------------ Leader-Follower ------------
@@ -106,7 +107,6 @@ static void run_all_algorithms_LF(int client_fd, int V, int E, int S) {
 
     // A lambda that runs a single algorithm on a given graph and streams its result immediately upon completion
     auto run_and_stream = [&](const char* tag, const std::string& algoName, const Graph& src){
-        Graph local = src; // make a local copy of the graph if the algorithm mutates internally, it won't affect others
         auto algo = AlgorithmFactory::createAlgorithm(algoName); // dynamically create the algorithm by name
         if (!algo) {
             // unknown algorithm name report an error to the client
@@ -114,7 +114,7 @@ static void run_all_algorithms_LF(int client_fd, int V, int E, int S) {
             return; // stop this thread
         }
         try {
-            std::string out = algo->run(local); // run the algorithm on the local copy and get textual output
+            std::string out = algo->runShared(src); // read-only algorithms share src; others get a copy-on-write copy
             if (!out.empty() && out.back() != '\n') out.push_back('\n'); // ensure it ends with a newline
             // prepend a tag header so the client knows which algorithm produced this output
             send_line_threadsafe(client_fd, std::string("[") + tag + "]\n" + out, send_mtx);
@@ -128,7 +128,7 @@ static void run_all_algorithms_LF(int client_fd, int V, int E, int S) {
     };
 
     // Four threads whoever finishes first sends first
-    // Each std::thread receives the lambda + its parameters. std::cref passes a const reference to src (which is copied at lambda start).
+    // Each std::thread receives the lambda + its parameters. std::cref passes a const reference to src, shared by all four threads.
     std::thread t_scc( run_and_stream, "SCC",       "SCC",       std::cref(gDir)   ); // SCC runs on the directed graph
     std::thread t_mst( run_and_stream, "MST",       "MST",       std::cref(gUndir) ); // MST runs on the undirected graph
     std::thread t_ham( run_and_stream, "HAMILTON",  "HAMILTON",  std::cref(gUndir) ); // HAMILTON on the undirected graph
@@ -180,6 +180,14 @@ static void worker_thread(int listener_fd) {
             if (n == 0) break;                  // EOF client finished sending
             if (n < 0) { if (errno == EINTR) continue; break; } // if interrupted, retry; otherwise it's an error
             req.append(buf, buf + n);           // append the newly read bytes to the request string
+            if (req.size() > MAX_REQUEST) break; // stop buffering a runaway request
+        }
+
+        if (req.size() > MAX_REQUEST) {
+            std::string msg = "ERROR: request longer than " + std::to_string(MAX_REQUEST) + " bytes\n";
+            send_all(client_fd, msg.c_str(), msg.size());
+            ::close(client_fd);
+            continue; // go handle the next client
         }
 
         std::string alg; int V=0, E=0, S=0; std::string err; // parameters to extract from the CLI 
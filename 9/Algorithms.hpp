@@ -1,17 +1,30 @@
 #ifndef ALGORITHMS_HPP
 #define ALGORITHMS_HPP
 #include "Graph.hpp"
+#include "CsrGraph.hpp"
+#include "GraphFile.hpp"
+#include "CompressedGraph.hpp"
+#include <string>
+#include <variant>
 
+/**
+ * @brief A graph in any of the representations the algorithms accept, by pointer (never null).
+ * Every alternative is const: an algorithm that needs to modify a Graph works on its own
+ * (copy-on-write) copy, so one graph can be shared by concurrent runs.
+ */
+using GraphView = std::variant<const Graph*, const CsrGraph*, const CompactCsrGraph*, const MappedGraph*, const CompressedGraph*>;
 
 class Algorithms{
     public:
-    ~Algorithms()=default;
+    virtual ~Algorithms()=default;
     /**
-     * @brief Activate the algorithm on the graph.
-     * @param g The graph
+     * @brief Activate the algorithm on the graph, whatever its representation.
+     * Implementations forward every alternative to one templated body, e.g.
+     * std::visit([this](auto graph) { return solve(*graph); }, g).
+     * @param g The graph (Graph, CSR snapshot, compact snapshot, mapped file or compressed rows)
      * @return A string containing the result of the algorithm.
      */
-    virtual std::string run(Graph& g)=0;
+    virtual std::string run(GraphView g)=0;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,149 @@
+
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include "Graph.hpp"
+#include "CompressedGraph.hpp"
+
+
+// ---------- Rows ----------
+
+CompressedRows::CompressedRows(const Graph& g, AdjacencyEncoding encoding)
+    : encoding(encoding), offsets(static_cast<std::size_t>(g.getNumVertices()) + 1, 0),
+      degrees(static_cast<std::size_t>(g.getNumVertices()), 0) {
+    const int V = g.getNumVertices();
+    std::vector<std::pair<int, int>> row; // Sorted copy of one neighbor list
+
+    for (int u = 0; u < V; ++u) {
+        const auto& neighbors = g.getNeighbors(u);
+        row.assign(neighbors.begin(), neighbors.end());
+        std::sort(row.begin(), row.end()); // Ids are unique, so this sorts by neighbor
+        degrees[u] = static_cast<std::uint32_t>(row.size());
+        entries += row.size();
+
+        std::uint32_t prev = 0;
+        if (encoding == AdjacencyEncoding::Varint) {
+            for (const auto& neighbor : row) {
+                AdjacencyCodec::putVarint(bytes, static_cast<std::uint32_t>(neighbor.first) - prev);
+                AdjacencyCodec::putVarint(bytes, static_cast<std::uint32_t>(neighbor.second));
+                prev = static_cast<std::uint32_t>(neighbor.first);
+            }
+        } else {
+            for (std::size_t i = 0; i < row.size(); i += 2) {
+                std::uint32_t group[4] = {static_cast<std::uint32_t>(row[i].first) - prev,
+                                          static_cast<std::uint32_t>(row[i].second), 0, 0};
+                prev = static_cast<std::uint32_t>(row[i].first);
+                if (i + 1 < row.size()) { // Odd rows end with a zero pair
+                    group[2] = static_cast<std::uint32_t>(row[i + 1].first) - prev;
+                    group[3] = static_cast<std::uint32_t>(row[i + 1].second);
+                    prev = static_cast<std::uint32_t>(row[i + 1].first);
+                }
+                AdjacencyCodec::putGroup(bytes, group);
+            }
+        }
+        offsets[u + 1] = bytes.size();
+    }
+
+    bytes.insert(bytes.end(), AdjacencyCodec::kPadding, 0); // Decoders may read past the last row
+    bytes.shrink_to_fit();
+}
+
+CompressedRows CompressedRows::transposeOf(const CompressedRows& rows) {
+    const int V = static_cast<int>(rows.degrees.size());
+    CompressedRows t;
+    t.encoding = AdjacencyEncoding::Varint;
+    t.offsets.assign(static_cast<std::size_t>(V) + 1, 0);
+    t.degrees.assign(static_cast<std::size_t>(V), 0);
+    t.entries = rows.entries;
+
+    // Sources arrive in ascending order, so each in-row's gaps (and byte size) are known in one pass
+    std::vector<std::uint32_t> last(V, 0); // Previous source written to each in-row
+    for (int u = 0; u < V; ++u) {
+        for (const auto& neighbor : rows.row(u)) {
+            const int v = neighbor.first;
+            t.offsets[v + 1] += AdjacencyCodec::varintLength(static_cast<std::uint32_t>(u) - last[v]) +
+                                AdjacencyCodec::varintLength(static_cast<std::uint32_t>(neighbor.second));
+            last[v] = static_cast<std::uint32_t>(u);
+            ++t.degrees[v];
+        }
+    }
+    for (int v = 0; v < V; ++v) t.offsets[v + 1] += t.offsets[v];
+
+    t.bytes.assign(t.offsets[V] + AdjacencyCodec::kPadding, 0);
+    std::vector<std::uint64_t> cursor(t.offsets.begin(), t.offsets.end() - 1);
+    std::fill(last.begin(), last.end(), 0);
+    for (int u = 0; u < V; ++u) {
+        for (const auto& neighbor : rows.row(u)) {
+            const int v = neighbor.first;
+            std::uint8_t* at = t.bytes.data() + cursor[v];
+            at = AdjacencyCodec::putVarint(at, static_cast<std::uint32_t>(u) - last[v]);
+            at = AdjacencyCodec::putVarint(at, static_cast<std::uint32_t>(neighbor.second));
+            cursor[v] = static_cast<std::uint64_t>(at - t.bytes.data());
+            last[v] = static_cast<std::uint32_t>(u);
+        }
+    }
+    return t;
+}
+
+// ---------- Graph ----------
+
+CompressedTranspose::CompressedTranspose(const CompressedGraph& g) : rows(CompressedRows::transposeOf(g.rows())) {}
+
+CompressedGraph::CompressedGraph(const Graph& g, AdjacencyEncoding encoding)
+    : V(g.getNumVertices()), directed(g.isDirected()), out(g, encoding) {
+    if (g.isRelabeled()) {
+        labels.resize(V);
+        for (int v = 0; v < V; ++v) labels[v] = g.originalId(v);
+    }
+}
+
+CompressedGraph::NeighborRange CompressedGraph::getNeighbors(int v) const {
+    if (v < 0 || v >= V)
+    {
+        std::cerr << "Error: Vertex out of bounds (getNeighbors)" << std::endl;
+        return NeighborRange(nullptr, 0, false);
+    }
+    return out.row(v);
+}
+
+CompressedGraph::NeighborRange CompressedGraph::getInNeighbors(int v) const {
+    if (v < 0 || v >= V)
+    {
+        std::cerr << "Error: Vertex out of bounds (getInNeighbors)" << std::endl;
+        return NeighborRange(nullptr, 0, false);
+    }
+    return transpose.get(*this).rows.row(v);
+}
+
+bool CompressedGraph::isEdgeConnected(int u, int v) const {
+    if (u < 0 || u >= V || v < 0 || v >= V)
+    {
+        std::cerr << "Error: Vertex out of bounds (isConnected)" << std::endl;
+        return false;
+    }
+    for (const auto& neighbor : out.row(u))
+    {
+        if (neighbor.first >= v) // Rows are sorted: stop at the first id not below v
+            return neighbor.first == v;
+    }
+    return false;
+}
+
+int CompressedGraph::get_out_degree(int v) const {
+    if (v < 0 || v >= V)
+    {
+        std::cerr << "Error: Vertex out of bounds (out_degree)" << std::endl;
+        return -1;
+    }
+    return static_cast<int>(out.degree(v));
+}
+
+int CompressedGraph::get_in_degree(int v) const {
+    if (v < 0 || v >= V)
+    {
+        std::cerr << "Error: Vertex out of bounds (in_degree)" << std::endl;
+        return -1;
+    }
+    return static_cast<int>(transpose.get(*this).rows.degree(v));
+}
@@ -0,0 +1,290 @@
+#ifndef COMPRESSED_GRAPH_HPP
+#define COMPRESSED_GRAPH_HPP
+
+#include <vector>
+#include <utility> // For std::pair
+#include <iterator>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+#include "Graph.hpp"
+#include "Transpose.hpp"
+
+// Byte layout of the compressed rows (see AdjacencyCodec)
+enum class AdjacencyEncoding { Varint, GroupVarint };
+
+/**
+ * @brief Integer codecs for compressed adjacency rows (native little-endian).
+ *
+ * Varint: LEB128, 7 bits per byte, the high bit set on every byte but the last.
+ * GroupVarint: four values behind one control byte that holds their byte
+ * lengths minus one (2 bits each, first value in the low bits), followed by
+ * the values in 1..4 bytes each. A group decodes with one SSSE3 shuffle when
+ * the compiler targets it (e.g. "make SIMD=-mavx2"), else with four masked
+ * loads; both may read up to kPadding bytes past the last group.
+ */
+struct AdjacencyCodec
+{
+    static constexpr std::size_t kPadding = 16;
+
+    static std::size_t varintLength(std::uint32_t x)
+    {
+        std::size_t n = 1;
+        for (; x >= 0x80; x >>= 7) ++n;
+        return n;
+    }
+
+    static std::uint8_t* putVarint(std::uint8_t* out, std::uint32_t x)
+    {
+        for (; x >= 0x80; x >>= 7) *out++ = static_cast<std::uint8_t>(x | 0x80);
+        *out++ = static_cast<std::uint8_t>(x);
+        return out;
+    }
+
+    static void putVarint(std::vector<std::uint8_t>& out, std::uint32_t x)
+    {
+        std::uint8_t buf[5];
+        out.insert(out.end(), buf, putVarint(buf, x));
+    }
+
+    static std::uint32_t getVarint(const std::uint8_t*& p)
+    {
+        std::uint32_t x = *p & 0x7F;
+        for (int shift = 7; *p++ & 0x80; shift += 7) x |= static_cast<std::uint32_t>(*p & 0x7F) << shift;
+        return x;
+    }
+
+    static void putGroup(std::vector<std::uint8_t>& out, const std::uint32_t v[4])
+    {
+        std::size_t control = out.size();
+        out.push_back(0);
+        for (int i = 0; i < 4; ++i) {
+            std::size_t len = v[i] < (1u << 8) ? 1 : v[i] < (1u << 16) ? 2 : v[i] < (1u << 24) ? 3 : 4;
+            out[control] |= static_cast<std::uint8_t>((len - 1) << (2 * i));
+            for (std::size_t b = 0; b < len; ++b) out.push_back(static_cast<std::uint8_t>(v[i] >> (8 * b)));
+        }
+    }
+
+    // Decode one group into v; returns the first byte after it
+    static const std::uint8_t* getGroup(const std::uint8_t* p, std::uint32_t v[4])
+    {
+        const unsigned control = *p++;
+#if defined(__SSSE3__)
+        const GroupTables& t = groupTables();
+        __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t.shuffle[control]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(v), _mm_shuffle_epi8(data, mask));
+        return p + t.length[control];
+#else
+        for (int i = 0; i < 4; ++i) {
+            unsigned len = ((control >> (2 * i)) & 3) + 1;
+            std::uint32_t x;
+            std::memcpy(&x, p, sizeof(x));
+            v[i] = len == 4 ? x : x & ((1u << (8 * len)) - 1);
+            p += len;
+        }
+        return p;
+#endif
+    }
+
+    private:
+        // Per control byte: pshufb mask gathering the four values, and the group's data length
+        struct GroupTables
+        {
+            alignas(16) std::uint8_t shuffle[256][16];
+            std::uint8_t length[256];
+
+            GroupTables()
+            {
+                for (unsigned c = 0; c < 256; ++c) {
+                    unsigned at = 0;
+                    for (unsigned i = 0; i < 4; ++i) {
+                        unsigned len = ((c >> (2 * i)) & 3) + 1;
+                        for (unsigned b = 0; b < 4; ++b)
+                            shuffle[c][4 * i + b] = b < len ? static_cast<std::uint8_t>(at + b) : 0x80; // 0x80 -> zero byte
+                        at += len;
+                    }
+                    length[c] = static_cast<std::uint8_t>(at);
+                }
+            }
+        };
+
+        static const GroupTables& groupTables()
+        {
+            static const GroupTables tables; // Built once, on first use
+            return tables;
+        }
+};
+
+/**
+ * @brief V adjacency rows, each sorted by neighbor id and stored as gaps.
+ *
+ * Entry i of a row is the pair (id_i - id_{i-1}, weight) with id_{-1} = 0,
+ * encoded with the row's AdjacencyEncoding. GroupVarint packs two entries per
+ * group (a row of odd length ends with a zero pair). Rows are decoded while
+ * iterating, never expanded into a list.
+ */
+class CompressedRows
+{
+    AdjacencyEncoding encoding = AdjacencyEncoding::Varint;
+    std::vector<std::uint64_t> offsets; // V + 1 byte offsets into bytes
+    std::vector<std::uint32_t> degrees; // Entries per row
+    std::vector<std::uint8_t> bytes;    // Encoded rows, then kPadding zero bytes
+    std::uint64_t entries = 0;          // Sum of degrees
+
+    public:
+        // Decodes one row, yielding {neighbor, weight} pairs like Graph::getNeighbors
+        class NeighborIterator
+        {
+            const std::uint8_t* p = nullptr;  // Next undecoded byte
+            std::uint32_t left = 0;           // Entries from the current one to the end of the row
+            bool grouped = false;
+            std::uint32_t id = 0, w = 0;      // Current entry
+            std::uint32_t nextGap = 0, nextW = 0; // GroupVarint: second entry of the current group
+            bool haveNext = false;
+
+            void decode()
+            {
+                if (left == 0) return;
+                if (!grouped) {
+                    id += AdjacencyCodec::getVarint(p);
+                    w = AdjacencyCodec::getVarint(p);
+                } else if (haveNext) {
+                    id += nextGap;
+                    w = nextW;
+                    haveNext = false;
+                } else {
+                    std::uint32_t v[4];
+                    p = AdjacencyCodec::getGroup(p, v);
+                    id += v[0];
+                    w = v[1];
+                    nextGap = v[2];
+                    nextW = v[3];
+                    haveNext = true;
+                }
+            }
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = std::pair<int, int>;
+                using difference_type = std::ptrdiff_t;
+                using pointer = void;
+                using reference = std::pair<int, int>;
+
+                NeighborIterator() = default;
+                NeighborIterator(const std::uint8_t* p, std::uint32_t n, bool grouped) : p(p), left(n), grouped(grouped) { decode(); }
+
+                std::pair<int, int> operator*() const { return {static_cast<int>(id), static_cast<int>(w)}; }
+                NeighborIterator& operator++() { --left; decode(); return *this; }
+                NeighborIterator operator++(int) { NeighborIterator old = *this; ++(*this); return old; }
+                bool operator==(const NeighborIterator& other) const { return left == other.left; }
+                bool operator!=(const NeighborIterator& other) const { return left != other.left; }
+        };
+
+        class NeighborRange
+        {
+            const std::uint8_t* p;
+            std::uint32_t n;
+            bool grouped;
+            public:
+                NeighborRange(const std::uint8_t* p, std::uint32_t n, bool grouped) : p(p), n(n), grouped(grouped) {}
+
+                NeighborIterator begin() const { return {p, n, grouped}; }
+                NeighborIterator end() const { return {p, 0, grouped}; }
+                std::size_t size() const { return n; }
+                bool empty() const { return n == 0; }
+        };
+
+        CompressedRows() = default;
+
+        // The rows of g, each sorted by neighbor id
+        CompressedRows(const Graph& g, AdjacencyEncoding encoding);
+
+        // In-edges of rows, always Varint: row v lists {u, w} for every u -> v, u ascending.
+        // Written straight from the encoded rows in two passes, with O(V) extra memory.
+        static CompressedRows transposeOf(const CompressedRows& rows);
+
+        // Caller guarantees 0 <= v < V
+        NeighborRange row(int v) const
+        {
+            return NeighborRange(bytes.data() + offsets[v], degrees[v], encoding == AdjacencyEncoding::GroupVarint);
+        }
+
+        std::uint32_t degree(int v) const { return degrees[v]; }
+
+        std::uint64_t numEntries() const { return entries; }
+
+        AdjacencyEncoding getEncoding() const { return encoding; }
+
+        std::size_t memoryBytes() const
+        {
+            return bytes.capacity() + offsets.capacity() * sizeof(std::uint64_t) + degrees.capacity() * sizeof(std::uint32_t);
+        }
+};
+
+class CompressedGraph;
+
+// In-edge rows of a CompressedGraph, built on demand (see BasicTransposeCache)
+struct CompressedTranspose
+{
+    CompressedRows rows;
+
+    explicit CompressedTranspose(const CompressedGraph& g);
+};
+
+/**
+ * @brief Read-only snapshot of a Graph with compressed adjacency rows.
+ *
+ * Each neighbor list is sorted and stored as gap-encoded varints (about
+ * 2-4 bytes per entry for sparse graphs, instead of 8), for graphs where
+ * memory rather than CPU is the limit. Traversals decode rows on the fly
+ * through NeighborIterator, so getNeighbors works in every algorithm and DFS
+ * without materializing lists. Because rows are sorted, results that depend
+ * on neighbor order (DFS order, ties) may differ from the source Graph.
+ * There is no edge index: isEdgeConnected decodes row u until it passes v.
+ */
+class CompressedGraph
+{
+    int V; // Number of vertices
+    bool directed = false; // Directed or undirected graph
+    CompressedRows out; // Out-edges
+    std::vector<int> labels; // Original ids of a relabeled source Graph (empty = identity)
+    BasicTransposeCache<CompressedTranspose> transpose; // In-edges, built on first use
+
+    public:
+        using NeighborIterator = CompressedRows::NeighborIterator;
+        using NeighborRange = CompressedRows::NeighborRange;
+
+        explicit CompressedGraph(const Graph& g, AdjacencyEncoding encoding = AdjacencyEncoding::Varint);
+
+        NeighborRange getNeighbors(int v) const;
+
+        NeighborRange getInNeighbors(int v) const; // {u, weight} for every edge u -> v, u ascending
+
+        const CompressedRows& rows() const { return out; }
+
+        bool isDirected() const { return directed; }
+
+        int getNumVertices() const { return V; }
+
+        int originalId(int v) const { return labels.empty() ? v : labels[v]; } // See Graph::relabel
+
+        long long getNumEdges() const { return static_cast<long long>(out.numEntries()); } // Stored (directed) adjacency entries
+
+        AdjacencyEncoding getEncoding() const { return out.getEncoding(); }
+
+        std::size_t memoryBytes() const { return out.memoryBytes(); } // Out-edge storage, excluding the transpose
+
+        bool isEdgeConnected(int u, int v) const;
+
+        int get_out_degree(int v) const;
+
+        int get_in_degree(int v) const;
+};
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef CSR_GRAPH_HPP
+#define CSR_GRAPH_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <iostream>
+
+#include "EdgeIndex.hpp"
+#include "Graph.hpp"
+#include "NeighborRange.hpp"
+#include "Transpose.hpp"
+
+/**
+ * @brief Immutable compressed-sparse-row snapshot of a Graph.
+ *
+ * The neighbors of vertex v are targets[offsets[v] .. offsets[v+1]) with the
+ * matching weights at the same indices. The order of every neighbor list is
+ * the insertion order of the source Graph, so algorithms produce the same
+ * output on either representation.
+ *
+ * VId and W set the stored widths of neighbor ids and weights. They live in
+ * separate arrays (struct of arrays), so narrow types shrink memory directly
+ * and traversals that only read ids never touch the weights.
+ */
+template <typename VId, typename W>
+class BasicCsrGraph
+{
+    int V; // Number of vertices
+    bool directed = false; // Directed or undirected graph
+    std::vector<std::size_t> offsets; // V + 1 row offsets into targets/weights
+    std::vector<VId> targets; // Neighbor ids, row after row
+    std::vector<W> weights;   // Edge weights, parallel to targets
+    EdgeIndex edgeIndex; // O(1) isEdgeConnected for the adjacency-heavy algorithms
+    TransposeCache<VId, W> transpose; // In-edges, built on first use
+    std::vector<int> labels; // Original ids of a relabeled source Graph (empty = identity)
+
+    public:
+        using NeighborIterator = SoaNeighborIterator<VId, W>;
+        using NeighborRange = SoaNeighborRange<VId, W>;
+
+        // Throws std::out_of_range if a vertex id or weight does not fit VId / W
+        explicit BasicCsrGraph(const Graph& g) : V(g.getNumVertices()), directed(g.isDirected()), offsets(static_cast<std::size_t>(V) + 1, 0)
+        {
+            if (V > 0 && static_cast<unsigned long long>(V - 1) > static_cast<unsigned long long>(std::numeric_limits<VId>::max()))
+                throw std::out_of_range("CsrGraph: vertex ids do not fit the id type");
+
+            // First pass: row sizes -> prefix sums
+            for (int u = 0; u < V; ++u) {
+                offsets[u + 1] = offsets[u] + g.getNeighbors(u).size();
+            }
+
+            targets.resize(offsets[V]);
+            weights.resize(offsets[V]);
+
+            // Second pass: copy every row into its slot, keeping insertion order
+            for (int u = 0; u < V; ++u) {
+                std::size_t pos = offsets[u];
+                for (const auto& neighbor : g.getNeighbors(u)) {
+                    if (neighbor.second < 0 || static_cast<unsigned long long>(neighbor.second) >
+                                                   static_cast<unsigned long long>(std::numeric_limits<W>::max()))
+                        throw std::out_of_range("CsrGraph: edge weight does not fit the weight type");
+                    targets[pos] = static_cast<VId>(neighbor.first);
+                    weights[pos] = static_cast<W>(neighbor.second);
+                    ++pos;
+                }
+            }
+
+            if (g.isRelabeled()) {
+                labels.resize(V);
+                for (int v = 0; v < V; ++v) labels[v] = g.originalId(v);
+            }
+
+            edgeIndex.reset(V, EdgeIndex::choose(V, targets.size()), targets.size());
+            for (int u = 0; u < V; ++u) {
+                for (std::size_t i = offsets[u]; i < offsets[u + 1]; ++i)
+                    edgeIndex.insert(u, static_cast<int>(targets[i]));
+            }
+        }
+
+        NeighborRange getNeighbors(int v) const
+        {
+            if (v < 0 || v >= V)
+            {
+                std::cerr << "Error: Vertex out of bounds (getNeighbors)" << std::endl;
+                return NeighborRange(nullptr, nullptr, 0);
+            }
+            return NeighborRange(targets.data() + offsets[v], weights.data() + offsets[v],
+                                 offsets[v + 1] - offsets[v]);
+        }
+
+        // {u, weight} for every edge u -> v, u ascending (transpose built on first call)
+        NeighborRange getInNeighbors(int v) const
+        {
+            if (v < 0 || v >= V)
+            {
+                std::cerr << "Error: Vertex out of bounds (getInNeighbors)" << std::endl;
+                return NeighborRange(nullptr, nullptr, 0);
+            }
+            return transpose.get(*this).in(v);
+        }
+
+        // Raw row access for callers that only need the neighbor ids
+        const VId* targetsBegin(int v) const { return targets.data() + offsets[v]; }
+        const VId* targetsEnd(int v) const { return targets.data() + offsets[v + 1]; }
+
+        bool isDirected() const { return directed; }
+
+        int getNumVertices() const { return V; }
+
+        int originalId(int v) const { return labels.empty() ? v : labels[v]; } // See Graph::relabel
+
+        long long getNumEdges() const { return static_cast<long long>(offsets[V]); } // Stored (directed) adjacency entries
+
+        bool isEdgeConnected(int u, int v) const // Check if there's an edge from u to v
+        {
+            if (u < 0 || u >= V || v < 0 || v >= V)
+            {
+                std::cerr << "Error: Vertex out of bounds (isConnected)" << std::endl;
+                return false;
+            }
+
+            if (edgeIndex.enabled())
+                return edgeIndex.contains(u, v);
+
+            for (const VId* t = targetsBegin(u); t != targetsEnd(u); ++t)
+            {
+                if (static_cast<int>(*t) == v)
+                    return true;
+            }
+            return false;
+        }
+
+        int get_out_degree(int v) const
+        {
+            if (v < 0 || v >= V)
+            {
+                std::cerr << "Error: Vertex out of bounds (out_degree)" << std::endl;
+                return -1;
+            }
+            return static_cast<int>(offsets[v + 1] - offsets[v]);
+        }
+
+        int get_in_degree(int v) const
+        {
+            if (v < 0 || v >= V)
+            {
+                std::cerr << "Error: Vertex out of bounds (in_degree)" << std::endl;
+                return -1;
+            }
+            return transpose.get(*this).inDegree(v);
+        }
+};
+
+// 4-byte ids and 1-byte weights: 5 bytes per adjacency entry instead of 8
+using CompactCsrGraph = BasicCsrGraph<std::uint32_t, std::uint8_t>;
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef EDGE_INDEX_HPP
+#define EDGE_INDEX_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Constant-time "is there an edge u -> v" lookup.
+ *
+ * Two layouts are available: a dense V x V bit matrix for small or dense
+ * graphs, and an open-addressing hash set of packed (u, v) keys (linear
+ * probing, load factor <= 1/2) for large sparse graphs.
+ * choose() picks one from the vertex count and the expected number of
+ * directed adjacency entries.
+ */
+class EdgeIndex
+{
+    public:
+        enum class Kind { None, BitMatrix, HashSet };
+
+        // Bit matrices at or below this size are always used (V <= ~720)
+        static constexpr std::size_t kSmallMatrixBytes = 64 * 1024;
+        // Per-entry footprint of the hash table at its maximum load factor
+        static constexpr std::size_t kHashEntryBytes = 16;
+
+        static Kind choose(int V, std::size_t expectedEntries)
+        {
+            if (V <= 0) return Kind::None;
+            std::size_t matrixBytes = (static_cast<std::size_t>(V) * static_cast<std::size_t>(V) + 7) / 8;
+            if (matrixBytes <= kSmallMatrixBytes || matrixBytes <= expectedEntries * kHashEntryBytes)
+                return Kind::BitMatrix;
+            return Kind::HashSet;
+        }
+
+        EdgeIndex() = default;
+
+        void reset(int vertices, Kind k, std::size_t expectedEntries = 0)
+        {
+            V = vertices;
+            kind = k;
+            bits.clear();
+            slots.clear();
+            used = 0;
+            if (kind == Kind::BitMatrix) {
+                std::size_t cells = static_cast<std::size_t>(V) * static_cast<std::size_t>(V);
+                bits.assign((cells + 63) / 64, 0);
+            } else if (kind == Kind::HashSet) {
+                rehash(expectedEntries);
+            }
+        }
+
+        Kind getKind() const { return kind; }
+
+        bool enabled() const { return kind != Kind::None; }
+
+        void insert(int u, int v)
+        {
+            if (kind == Kind::BitMatrix) {
+                std::size_t cell = cellOf(u, v);
+                bits[cell >> 6] |= (std::uint64_t(1) << (cell & 63));
+            } else if (kind == Kind::HashSet) {
+                if (2 * (used + 1) > slots.size()) rehash(used + 1);
+                std::uint64_t key = keyOf(u, v);
+                std::size_t i = slotOf(key);
+                while (slots[i] != kEmpty) {
+                    if (slots[i] == key) return;
+                    i = (i + 1) & (slots.size() - 1);
+                }
+                slots[i] = key;
+                ++used;
+            }
+        }
+
+        void erase(int u, int v)
+        {
+            if (kind == Kind::BitMatrix) {
+                std::size_t cell = cellOf(u, v);
+                bits[cell >> 6] &= ~(std::uint64_t(1) << (cell & 63));
+            } else if (kind == Kind::HashSet) {
+                const std::size_t mask = slots.size() - 1;
+                std::uint64_t key = keyOf(u, v);
+                std::size_t hole = slotOf(key);
+                while (slots[hole] != key) {
+                    if (slots[hole] == kEmpty) return;
+                    hole = (hole + 1) & mask;
+                }
+                // Backward-shift deletion (no tombstones): a later key in the probe run
+                // moves into the hole unless its home slot lies after the hole
+                for (std::size_t i = (hole + 1) & mask; slots[i] != kEmpty; i = (i + 1) & mask) {
+                    if (((i - slotOf(slots[i])) & mask) >= ((i - hole) & mask)) {
+                        slots[hole] = slots[i];
+                        hole = i;
+                    }
+                }
+                slots[hole] = kEmpty;
+                --used;
+            }
+        }
+
+        // Caller guarantees enabled() and 0 <= u, v < V
+        bool contains(int u, int v) const
+        {
+            if (kind == Kind::BitMatrix) {
+                std::size_t cell = cellOf(u, v);
+                return (bits[cell >> 6] >> (cell & 63)) & 1;
+            }
+            std::uint64_t key = keyOf(u, v);
+            for (std::size_t i = slotOf(key); slots[i] != kEmpty; i = (i + 1) & (slots.size() - 1)) {
+                if (slots[i] == key) return true;
+            }
+            return false;
+        }
+
+    private:
+        int V = 0;
+        Kind kind = Kind::None;
+        std::vector<std::uint64_t> bits;          // Row-major V x V bit matrix
+        std::vector<std::uint64_t> slots;         // (u << 32) | v, or kEmpty
+        std::size_t used = 0;                     // Occupied slots
+        int shift = 64;                           // 64 - log2(slots.size())
+
+        // Vertex ids are < 2^31, so no real key has every bit set
+        static constexpr std::uint64_t kEmpty = ~std::uint64_t(0);
+
+        // Fibonacci hashing: the top bits of key * 2^64/phi
+        std::size_t slotOf(std::uint64_t key) const
+        {
+            return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> shift);
+        }
+
+        // Grow to a power of two holding at least 'entries' keys at load <= 1/2
+        void rehash(std::size_t entries)
+        {
+            std::size_t capacity = 16;
+            int log2Capacity = 4;
+            while (capacity < 2 * entries) { capacity <<= 1; ++log2Capacity; }
+            if (capacity <= slots.size()) return;
+
+            std::vector<std::uint64_t> old;
+            old.swap(slots);
+            slots.assign(capacity, kEmpty);
+            shift = 64 - log2Capacity;
+            for (std::uint64_t key : old) {
+                if (key == kEmpty) continue;
+                std::size_t i = slotOf(key);
+                while (slots[i] != kEmpty) i = (i + 1) & (capacity - 1);
+                slots[i] = key;
+            }
+        }
+
+        std::size_t cellOf(int u, int v) const
+        {
+            return static_cast<std::size_t>(u) * static_cast<std::size_t>(V) + static_cast<std::size_t>(v);
+        }
+
+        static std::uint64_t keyOf(int u, int v)
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(u)) << 32) | static_cast<std::uint32_t>(v);
+        }
+};
+#endif
@@ -17,8 +17,9 @@
 class AlgorithmFactory {
 public:
     static std::unique_ptr<Algorithms> createAlgorithm(const std::string& algorithmName) {
-        if (algorithmName == "MST") {
-            return std::make_unique<MST>();
+        MST::Method mstMethod;
+        if (MST::parseMethod(algorithmName, mstMethod)) {
+            return std::make_unique<MST>(mstMethod);
         } else if (algorithmName == "SCC") {
             return std::make_unique<SCC>();
         } else if(algorithmName=="HAMILTON"){
@@ -1,16 +1,62 @@
 #include <vector>
 #include <iostream>
-#include <algorithm> // For std::find
+#include <random>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+#include <string>
+#include <unordered_map>
 
 #include "Graph.hpp"
+#include "Traversal.hpp"
+#include "CsrGraph.hpp"
 
 
-class Graph; 
-void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
 
 
 
-        Graph::Graph(int V, bool directed) : V(V), adj(V), directed(directed) {}
+        Graph::Storage::Storage(int V, std::size_t expectedEntries, std::pmr::memory_resource* upstream)
+            : arena(std::make_unique<GraphArena>(expectedEntries * sizeof(std::pair<int,int>), upstream)),
+              adj(V, AdjacencyRow(AdjacencyRow::allocator_type(arena.get()))), inDeg(V, 0), outDeg(V, 0)
+            {
+                edgeIndex.reset(V, EdgeIndex::choose(V, 0));
+            }
+
+        Graph::Storage::Storage(const Storage& other)
+            : arena(std::make_unique<GraphArena>(other.entries() * sizeof(std::pair<int,int>), other.arena->upstream())),
+              edgeIndex(other.edgeIndex), inDeg(other.inDeg), outDeg(other.outDeg), labels(other.labels)
+            {
+                adj.reserve(other.adj.size());
+                for (const AdjacencyRow& row : other.adj)
+                    adj.emplace_back(row, AdjacencyRow::allocator_type(arena.get())); // Exact size, one memcpy
+            }
+
+        std::size_t Graph::Storage::entries() const
+            {
+                std::size_t entries = 0;
+                for (const auto& row : adj)
+                    entries += row.size();
+                return entries;
+            }
+
+        Graph::Graph(int V, bool directed, std::size_t expectedEntries, std::pmr::memory_resource* upstream)
+            : V(V), directed(directed), store(std::make_shared<Storage>(V, expectedEntries, upstream))
+            {
+            }
+
+        void Graph::detach()
+            {
+                // Safe against concurrent readers of the other copies: they never write
+                // through store, and a count of 1 means no other Graph can reach it
+                if (store.use_count() > 1)
+                    store = std::make_shared<Storage>(*store);
+            }
+
+        std::size_t Graph::countEntries() const
+            {
+                return store->entries();
+            }
 
         void Graph::addEdge(int u, int v, int w) // Add edge from u to v
             {
@@ -36,24 +82,129 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                     return;
                 }
 
-                adj[u].push_back({v, w}); // Add edge from u to v
+                detach();
+                transpose.invalidate(); // Rebuilt by the next getInNeighbors
+                link(u, v, w);
+                ++version;
+            }
+
+        void Graph::removeEdge(int u, int v)
+            {
+                if (u < 0 || u >= V || v < 0 || v >= V)
+                {
+                    std::cerr << "Error: Vertex out of bounds (removeEdge)" << std::endl;
+                    return;
+                }
+                if (!isEdgeConnected(u, v))
+                {
+                    std::cerr << "Error: Edge does not exist (removeEdge)" << std::endl;
+                    return;
+                }
+
+                detach();
+                transpose.invalidate();
+                unlink(u, v);
+                ++version;
+            }
+
+        void Graph::applyBatch(const EdgeBatch& batch)
+            {
+                // Validate everything first, tracking the state of the edges the batch touches
+                std::unordered_map<std::uint64_t, bool> present;
+                for (std::size_t i = 0; i < batch.getUpdates().size(); ++i)
+                {
+                    const EdgeBatch::Update& op = batch.getUpdates()[i];
+                    const std::string where = "applyBatch: update " + std::to_string(i) + ": ";
+                    if (op.u < 0 || op.u >= V || op.v < 0 || op.v >= V)
+                        throw std::invalid_argument(where + "vertex out of bounds");
+                    if (op.insert && op.w < 0)
+                        throw std::invalid_argument(where + "negative weight");
+                    if (op.insert && op.u == op.v)
+                        throw std::invalid_argument(where + "self-loop");
+
+                    int a = op.u, b = op.v;
+                    if (!directed && a > b) std::swap(a, b); // Both directions are one edge
+                    const std::uint64_t key = (static_cast<std::uint64_t>(a) << 32) | static_cast<std::uint32_t>(b);
+                    auto it = present.find(key);
+                    const bool exists = it != present.end() ? it->second : isEdgeConnected(op.u, op.v);
+                    if (op.insert && exists)
+                        throw std::invalid_argument(where + "edge already exists");
+                    if (!op.insert && !exists)
+                        throw std::invalid_argument(where + "edge does not exist");
+                    present[key] = op.insert;
+                }
+
+                if (batch.getUpdates().empty())
+                    return;
+
+                detach();
+                transpose.invalidate();
+                for (const EdgeBatch::Update& op : batch.getUpdates())
+                {
+                    if (op.insert)
+                        link(op.u, op.v, op.w);
+                    else
+                        unlink(op.u, op.v);
+                }
+                ++version; // One version for the whole batch
+            }
+
+        void Graph::link(int u, int v, int w)
+            {
+                store->adj[u].push_back({v, w}); // Add edge from u to v
+                store->edgeIndex.insert(u, v);
+                ++store->outDeg[u];
+                ++store->inDeg[v];
                 
                 if(!directed){
-                    adj[v].push_back({u, w});  // For undirected graph
+                    store->adj[v].push_back({u, w});  // For undirected graph
+                    store->edgeIndex.insert(v, u);
+                    ++store->outDeg[v];
+                    ++store->inDeg[u];
+                }
+            }
+
+        void Graph::unlink(int u, int v)
+            {
+                // erase, not swap-and-pop: the remaining neighbors keep their order
+                auto eraseEntry = [](AdjacencyRow& row, int target) {
+                    row.erase(std::find_if(row.begin(), row.end(),
+                                           [target](const std::pair<int,int>& e) { return e.first == target; }));
+                };
+
+                eraseEntry(store->adj[u], v);
+                store->edgeIndex.erase(u, v);
+                --store->outDeg[u];
+                --store->inDeg[v];
+
+                if (!directed) {
+                    eraseEntry(store->adj[v], u);
+                    store->edgeIndex.erase(v, u);
+                    --store->outDeg[v];
+                    --store->inDeg[u];
                 }
-            
             }
 
 		
-        const std::vector<std::pair<int, int>>& Graph::getNeighbors(int v) const
+        const AdjacencyRow& Graph::getNeighbors(int v) const
             {
                 if(v < 0 || v >= V)
                 {
                     std::cerr << "Error: Vertex out of bounds (getNeighbros)" << std::endl;
-                    static const std::vector<std::pair<int, int>> empty; // Return an empty vector on error
+                    static const AdjacencyRow empty(AdjacencyRow::allocator_type(nullptr)); // Return an empty vector on error
                     return empty;
                 }
-                return adj[v];
+                return store->adj[v];
+            }
+
+        Graph::InNeighborRange Graph::getInNeighbors(int v) const
+            {
+                if(v < 0 || v >= V)
+                {
+                    std::cerr << "Error: Vertex out of bounds (getInNeighbors)" << std::endl;
+                    return InNeighborRange(nullptr, nullptr, 0);
+                }
+                return transpose.get(*this).in(v); // Built once, reused until the next edge change
             }
 
         int Graph::getNumVertices() const
@@ -74,7 +225,10 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                     return false;
                 }
 
-                for (std::pair neighbor : adj[u])
+                if (store->edgeIndex.enabled())
+                    return store->edgeIndex.contains(u, v);
+
+                for (std::pair neighbor : store->adj[u])
                 {
                     if (neighbor.first == v)
                         return true;
@@ -82,13 +236,37 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                 return false;
             }
 
+        void Graph::buildEdgeIndex(int expectedEdges)
+            {
+                std::size_t entries = countEntries();
+
+                // Undirected edges are stored in both rows
+                std::size_t expected = expectedEdges > 0 ? static_cast<std::size_t>(expectedEdges) * (directed ? 1 : 2) : 0;
+                if (expected < entries)
+                    expected = entries;
+
+                detach();
+                store->edgeIndex.reset(V, EdgeIndex::choose(V, expected), expected);
+                for (int u = 0; u < V; ++u)
+                {
+                    for (const auto& neighbor : store->adj[u])
+                        store->edgeIndex.insert(u, neighbor.first);
+                }
+            }
+
+        void Graph::dropEdgeIndex()
+            {
+                detach();
+                store->edgeIndex.reset(V, EdgeIndex::Kind::None);
+            }
+
         
         void Graph::printGraph() const
             {
                 for (int i = 0; i < V; ++i)
                 {
                     std::cout << "Vertex " << i << ":";
-                    for (std::pair<int,int> neighbor : adj[i])
+                    for (std::pair<int,int> neighbor : store->adj[i])
                     {
                         std::cout << " " << neighbor.first << "(weight " << neighbor.second << ")";
                     }
@@ -111,7 +289,7 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                     return in_deg + out_deg; // Total degree is sum of in-degree and out-degree
                 }
 
-                return adj[v].size(); // Degree in not directed graph is simply the size of the adjacency list
+                return store->adj[v].size(); // Degree in not directed graph is simply the size of the adjacency list
             }
         
         int Graph::get_in_degree(int v) const
@@ -122,18 +300,7 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                 return -1;
             }
 
-            int in_deg = 0;
-            for (int i = 0; i < V; ++i) // Iterate through all vertices
-            {
-                for (const auto& neighbor : adj[i]) // Check their adjacency lists
-                {
-                    if (neighbor.first == v) // If there's an edge to vertex v
-                    {
-                        ++in_deg;
-                    }
-                }
-            }
-            return in_deg;
+            return store->inDeg[v]; // Counted incrementally by addEdge
         }
 
         int Graph::get_out_degree(int v) const
@@ -143,7 +310,18 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                 std::cerr << "Error: Vertex out of bounds (out_degree)" << std::endl;
                 return -1;
             }
-            return adj[v].size(); // Out-degree is simply the size of the adjacency list
+            return store->outDeg[v]; // Same as adj[v].size(), counted incrementally by addEdge
+        }
+
+        bool Graph::hasEulerianDegrees() const
+        {
+            for (int i = 0; i < V; ++i)
+            {
+                if (directed ? store->inDeg[i] != store->outDeg[i] // Every vertex must be balanced
+                             : store->outDeg[i] % 2 != 0)    // Every vertex must have even degree
+                    return false;
+            }
+            return true;
         }
         
         bool Graph::isEulerian() const
@@ -163,26 +341,16 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                 return true;
             }   
 
-            if (directed){
-                for(int j = 0; j < V; j++){
-                    if(get_in_degree(j) != get_out_degree(j)){
-                        return false;
-                    }
-                }
-            } else{
-                // For undirected graph, check if all vertices have even degree
-                for (int i = 0; i < V; ++i)
-            {
-                if (degree(i) % 2 != 0) // If any vertex has an odd degree
-                    return false;
-            }
-
+            // Directed: in-degree equals out-degree everywhere; undirected: all degrees even
+            if (!hasEulerianDegrees()) {
+                return false;
             }
 
             std::vector<bool> visited(V, false);
 
-            // Run DFS from the first non-isolated vertex
-            DFS(start_node, visited, *this);
+            // Run DFS from the first non-isolated vertex (iterative, no output)
+            TraversalScratch<Graph> scratch;
+            iterativeDFS(*this, start_node, visited, scratch);
 
             // Check if all non-isolated vertices were visited
             for (int i = 0; i < V; ++i) {
@@ -208,85 +376,186 @@ void DFS(int start_node, std::vector<bool>& visited, const Graph& graph);
                 return;
             }
 
-            std::vector<std::vector<std::pair<int, int>>> tempAdj = adj; // Create a copy of the adjacency list
-            std::vector<int> circuit; // To store the Eulerian circuit
-            std::vector<int> stack; // Stack to hold the current path
-
             int currVertex = 0;
 
             // Start from the first vertex with edges
             for (int i = 0; i < V; ++i) {
-                    if (directed) {
-                        if (get_out_degree(i) > 0) {
-                            currVertex = i;
-                            break;
-                        }
-                    } else {
-                        if (degree(i) > 0) {
-                            currVertex = i;
-                            break;
-                        }
+                    if (get_out_degree(i) > 0) {
+                        currVertex = i;
+                        break;
+                    }
+                }
+
+            std::vector<int> circuit; // To store the Eulerian circuit
+            hierholzer(currVertex, circuit);
+
+            // Print the Eulerian circuit
+            std::cout << "Eulerian Circuit: ";
+            for (auto it = circuit.rbegin(); it != circuit.rend(); ++it) {
+                std::cout << *it << " ";
+            }
+            std::cout << std::endl;
+        }
+
+        int Graph::eulerPathStart() const
+        {
+            int start = -1;
+
+            if (directed) {
+                // Exactly one vertex with out - in == 1 (start) and one with in - out == 1 (end)
+                int starts = 0, ends = 0;
+                for (int i = 0; i < V; ++i) {
+                    int diff = store->outDeg[i] - store->inDeg[i];
+                    if (diff == 0) continue;
+                    if (diff == 1 && starts++ == 0) start = i;
+                    else if (diff == -1 && ends++ == 0) continue;
+                    else return -1;
+                }
+                if (starts != 1 || ends != 1) return -1;
+            } else {
+                // Exactly two odd-degree vertices; the path runs from the first to the second
+                int odd = 0;
+                for (int i = 0; i < V; ++i) {
+                    if (store->outDeg[i] % 2 != 0 && odd++ == 0) start = i;
+                }
+                if (odd != 2) return -1;
+            }
+
+            std::vector<bool> visited(V, false);
+            TraversalScratch<Graph> scratch;
+            iterativeDFS(*this, start, visited, scratch);
+
+            // Every vertex that touches an edge must be reachable from the start
+            for (int i = 0; i < V; ++i) {
+                if (store->outDeg[i] + store->inDeg[i] > 0 && !visited[i]) {
+                    return -1;
+                }
+            }
+            return start;
+        }
+
+        bool Graph::hasEulerPath() const
+        {
+            return eulerPathStart() != -1;
+        }
+
+        void Graph::findEulerPath(){
+
+            int start = eulerPathStart();
+            if (start == -1) {
+                std::cout << "The graph has no Eulerian path." << std::endl;
+                return;
+            }
+
+            std::vector<int> path;
+            hierholzer(start, path);
+
+            std::cout << "Eulerian Path: ";
+            for (auto it = path.rbegin(); it != path.rend(); ++it) {
+                std::cout << *it << " ";
+            }
+            std::cout << std::endl;
+        }
+
+        void Graph::hierholzer(int start, std::vector<int>& circuit) const
+        {
+            // Number the adjacency entries globally: adj[u][i] is half-edge off[u] + i
+            std::vector<int> off(V + 1, 0);
+            for (int u = 0; u < V; ++u) {
+                off[u + 1] = off[u] + static_cast<int>(store->adj[u].size());
+            }
+            const int H = off[V];
+
+            // Undirected edges are stored twice; twin[h] is the other copy so both share one ID.
+            // Pairing is O(V + E): bucket the u -> v (u < v) copies by v, then match them
+            // against the v -> u entries of adj[v] through a per-vertex slot table.
+            std::vector<int> twin;
+            if (!directed) {
+                twin.assign(H, -1);
+
+                std::vector<int> bucket(V + 1, 0);
+                for (int u = 0; u < V; ++u) {
+                    for (const auto& neighbor : store->adj[u]) {
+                        if (neighbor.first > u) ++bucket[neighbor.first + 1];
+                    }
+                }
+                for (int v = 0; v < V; ++v) {
+                    bucket[v + 1] += bucket[v];
+                }
+
+                std::vector<std::pair<int, int>> forward(bucket[V]); // {tail u, half-edge id}
+                std::vector<int> fill(bucket.begin(), bucket.end() - 1);
+                for (int u = 0; u < V; ++u) {
+                    for (int i = 0; i < static_cast<int>(store->adj[u].size()); ++i) {
+                        int v = store->adj[u][i].first;
+                        if (v > u) forward[fill[v]++] = {u, off[u] + i};
                     }
                 }
-                stack.push_back(currVertex);
 
+                std::vector<int> slotOf(V, -1);
+                for (int v = 0; v < V; ++v) {
+                    for (int i = 0; i < static_cast<int>(store->adj[v].size()); ++i) {
+                        int u = store->adj[v][i].first;
+                        if (u < v) slotOf[u] = off[v] + i;
+                    }
+                    for (int k = bucket[v]; k < bucket[v + 1]; ++k) {
+                        int h = forward[k].second;
+                        int r = slotOf[forward[k].first];
+                        twin[h] = r;
+                        twin[r] = h;
+                    }
+                }
+            }
+
+            std::vector<bool> used(H, false); // One bit per half-edge; both copies are set together
+            std::vector<int> next(V); // Entries of adj[u] not yet examined are [0, next[u])
+            for (int u = 0; u < V; ++u) {
+                next[u] = static_cast<int>(store->adj[u].size()); // Consume from the back, like pop_back did
+            }
+
+            std::vector<int> stack; // Stack to hold the current path
+            int currVertex = start;
+            stack.push_back(currVertex);
 
             while (!stack.empty()) {
-                if (tempAdj[currVertex].empty()) {
-                    // If no more neighbors, add to circuit
+                int& k = next[currVertex];
+                while (k > 0 && used[off[currVertex] + k - 1]) {
+                    --k; // Skip entries already consumed from the other endpoint
+                }
+
+                if (k == 0) {
+                    // If no more unused edges, add to circuit
                     circuit.push_back(currVertex);
                     currVertex = stack.back();
                     stack.pop_back();
                 } else {
                     // Otherwise, continue traversing
                     stack.push_back(currVertex);
-                    int nextVertex = tempAdj[currVertex].back().first;
-                    // Remove the edge from the graph
-                    tempAdj[currVertex].pop_back();
-                    
-                    // For undirected graph, remove the reverse edge as well
+                    --k;
+                    int h = off[currVertex] + k;
+                    used[h] = true;
                     if (!directed) {
-                        auto it = std::find_if(tempAdj[nextVertex].begin(), tempAdj[nextVertex].end(),
-                                       [&](const auto& pair) { return pair.first == currVertex; });
-                        if (it != tempAdj[nextVertex].end()) {
-                            tempAdj[nextVertex].erase(it);
-                        }
-
+                        used[twin[h]] = true; // Mark the reverse copy in O(1)
                     }
-                    currVertex = nextVertex;
+                    currVertex = store->adj[currVertex][k].first;
                 }
             }
-
-            // Print the Eulerian circuit
-            std::cout << "Eulerian Circuit: ";
-            for (auto it = circuit.rbegin(); it != circuit.rend(); ++it) {
-                std::cout << *it << " ";
-            }
-            std::cout << std::endl;
         }
 
 
 
-void DFS(int start_node, std::vector<bool>& visited, const Graph& graph) {
-    // Mark the current node as visited
-    visited[start_node] = true;
-    std::cout << start_node << " "; // Print the node
-
-    // Iterate through all neighbors of the current node
-    for (std::pair<int,int> neighbor : graph.getNeighbors(start_node)) {
-        //  Recursively call DFS for unvisited neighbors
-        if (!visited[neighbor.first]) {
-            DFS(neighbor.first, visited, graph);
-        }
-    }
-
-}
 
 Graph Graph::generateRandomGraph(int V, int E, int seed, bool directed) {
 
     srand(seed);
 
-    Graph g(V, directed);
+    // Rejection sampling only needs membership; the adjacency is built once at the end
+    std::size_t entries = static_cast<std::size_t>(E) * (directed ? 1 : 2);
+    EdgeIndex seen;
+    seen.reset(V, EdgeIndex::choose(V, entries), entries);
+
+    std::vector<Edge> edges;
+    edges.reserve(E);
    
     int edgesAdded = 0;
     while (edgesAdded < E) {
@@ -294,13 +563,283 @@ Graph Graph::generateRandomGraph(int V, int E, int seed, bool directed) {
         int v = rand() % V;
         int w = rand() % 10 + 1; // Random weight between 1 and 10
         
-        if (u != v && !g.isEdgeConnected(u, v)) { // Avoid self-loops and duplicate edges
-            g.addEdge(u, v, w);
+        if (u != v && !seen.contains(u, v)) { // Avoid self-loops and duplicate edges
+            seen.insert(u, v);
+            if (!directed) seen.insert(v, u);
+            edges.push_back({u, v, w});
             edgesAdded++;
         }
 
     }
+    return fromEdges(V, edges, directed);
+}
+
+Graph Graph::fromEdges(int V, const Edge* edges, std::size_t count, bool directed,
+                       DuplicatePolicy policy, LoadReport* report) {
+    LoadReport r;
+
+    auto valid = [&](const Edge& e, bool tally) {
+        if (e.u < 0 || e.u >= V || e.v < 0 || e.v >= V) { if (tally) ++r.outOfRange; return false; }
+        if (e.w < 0) { if (tally) ++r.negativeWeight; return false; }
+        if (e.u == e.v) { if (tally) ++r.selfLoops; return false; }
+        return true;
+    };
+
+    // Pass 1: histogram of half-edges per source (undirected edges are stored in both rows)
+    std::vector<std::size_t> start(V + 1, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!valid(edges[i], true)) continue;
+        ++start[edges[i].u + 1];
+        if (!directed) ++start[edges[i].v + 1];
+    }
+    for (int x = 0; x < V; ++x) start[x + 1] += start[x];
+
+    Graph g(V, directed, start[V]); // One slab for all rows (duplicates are dropped below)
+
+    // Pass 2: stable scatter by source, so each row keeps input order
+    std::vector<std::pair<int,int>> half(start[V]);
+    std::vector<std::size_t> fill(start.begin(), start.end() - 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        const Edge& e = edges[i];
+        if (!valid(e, false)) continue;
+        half[fill[e.u]++] = {e.v, e.w};
+        if (!directed) half[fill[e.v]++] = {e.u, e.w};
+    }
+
+    // Pass 3: per row, the first occurrence of a target keeps its position; repeats only
+    // update its weight according to the policy. Both copies of an undirected edge see
+    // the same weight sequence, so they stay consistent.
+    std::vector<int> lastRow(V, -1); // Row in which the target was last seen
+    std::vector<int> slot(V, 0);     // Its position in that row
+    std::size_t duplicateHalves = 0, entries = 0;
+    for (int u = 0; u < V; ++u) {
+        AdjacencyRow& row = g.store->adj[u];
+        row.reserve(start[u + 1] - start[u]);
+        for (std::size_t k = start[u]; k < start[u + 1]; ++k) {
+            int v = half[k].first, w = half[k].second;
+            if (lastRow[v] == u) {
+                ++duplicateHalves;
+                int& kept = row[slot[v]].second;
+                if (policy == DuplicatePolicy::KeepLast || (policy == DuplicatePolicy::KeepMinWeight && w < kept))
+                    kept = w;
+                continue;
+            }
+            lastRow[v] = u;
+            slot[v] = static_cast<int>(row.size());
+            row.push_back({v, w});
+            ++g.store->inDeg[v];
+        }
+        g.store->outDeg[u] = static_cast<int>(row.size());
+        entries += row.size();
+    }
+
+    r.duplicates = directed ? duplicateHalves : duplicateHalves / 2;
+    r.accepted = directed ? entries : entries / 2;
+
+    g.buildEdgeIndex(0); // Sized from the entries now present
+    if (report) *report = r;
+    return g;
+}
+
+Graph Graph::fromEdges(int V, const std::vector<Edge>& edges, bool directed,
+                       DuplicatePolicy policy, LoadReport* report) {
+    return fromEdges(V, edges.data(), edges.size(), directed, policy, report);
+}
+
+// ---------- Sampling helpers for the seeded generators ----------
+
+// Uniform double in [0, 1) from the top 53 bits
+static double uniform01(std::mt19937_64& rng) {
+    return (rng() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Uniform integer in [0, n) (multiply-shift, no modulo)
+static std::uint64_t uniformBelow(std::mt19937_64& rng, std::uint64_t n) {
+    return static_cast<std::uint64_t>((static_cast<unsigned __int128>(rng()) * n) >> 64);
+}
+
+// Keep every slot of [0, N) independently with probability p, in ascending order.
+// Geometric skipping (Batagelj & Brandes): one random draw per kept slot, O(kept + 1).
+static void bernoulliSlots(std::uint64_t N, double p, std::mt19937_64& rng, std::vector<std::uint64_t>& out) {
+    out.clear();
+    if (p <= 0.0 || N == 0) return;
+    if (p >= 1.0) {
+        out.resize(N);
+        for (std::uint64_t i = 0; i < N; ++i) out[i] = i;
+        return;
+    }
+
+    const double logQ = std::log1p(-p);
+    std::uint64_t i = 0;
+    while (i < N) {
+        double skip = std::floor(std::log1p(-uniform01(rng)) / logQ);
+        if (skip >= static_cast<double>(N - i)) break;
+        i += static_cast<std::uint64_t>(skip);
+        out.push_back(i++);
+    }
+}
+
+// Exactly m distinct slots of [0, N), ascending, uniformly over all m-subsets.
+// Oversample with geometric skipping, then drop the surplus at random positions.
+static void exactSlots(std::uint64_t N, std::uint64_t m, std::mt19937_64& rng, std::vector<std::uint64_t>& out) {
+    double p = (m + 3.0 * std::sqrt(static_cast<double>(m)) + 10.0) / static_cast<double>(N);
+    do {
+        bernoulliSlots(N, p, rng, out);
+    } while (out.size() < m); // Retried with fresh draws; rare by construction
+
+    // Floyd's algorithm picks which of the c candidates to drop
+    std::size_t c = out.size();
+    std::vector<bool> drop(c, false);
+    for (std::size_t j = m; j < c; ++j) {
+        std::size_t t = uniformBelow(rng, j + 1);
+        drop[drop[t] ? j : t] = true;
+    }
+
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < c; ++i) {
+        if (!drop[i]) out[kept++] = out[i];
+    }
+    out.resize(kept);
+}
+
+// Slots are numbered row by row: (u, v > u) for undirected, (u, v != u) for directed
+static std::uint64_t slotCount(int V, bool directed) {
+    std::uint64_t n = static_cast<std::uint64_t>(V);
+    return directed ? n * (n - 1) : n * (n - 1) / 2;
+}
+
+// Add the edges for ascending slots (or for every slot NOT listed, when complement is set)
+static void addSlotEdges(Graph& g, const std::vector<std::uint64_t>& slots, bool complement, std::mt19937_64& rng) {
+    const int V = g.getNumVertices();
+    const bool directed = g.isDirected();
+    const std::uint64_t N = slotCount(V, directed);
+
+    std::size_t next = 0; // Position in slots (complement mode)
+    std::uint64_t rowStart = 0;
+    int u = 0;
+
+    auto emit = [&](std::uint64_t slot) {
+        std::uint64_t rowLen = directed ? V - 1 : V - 1 - u;
+        while (slot >= rowStart + rowLen) {
+            rowStart += rowLen;
+            ++u;
+            rowLen = directed ? V - 1 : V - 1 - u;
+        }
+        int off = static_cast<int>(slot - rowStart);
+        int v = directed ? (off < u ? off : off + 1) : u + 1 + off;
+        g.addEdge(u, v, static_cast<int>(uniformBelow(rng, 10)) + 1); // Weight between 1 and 10
+    };
+
+    if (!complement) {
+        for (std::uint64_t slot : slots) emit(slot);
+        return;
+    }
+    for (std::uint64_t slot = 0; slot < N; ++slot) {
+        if (next < slots.size() && slots[next] == slot) { ++next; continue; }
+        emit(slot);
+    }
+}
+
+Graph Graph::generateRandomGraphGnm(int V, long long E, std::uint64_t seed, bool directed) {
+    if (V <= 0) throw std::invalid_argument("V must be positive");
+    const std::uint64_t N = slotCount(V, directed);
+    if (E < 0 || static_cast<std::uint64_t>(E) > N)
+        throw std::invalid_argument("E must be between 0 and the number of vertex pairs");
+
+    std::mt19937_64 rng(seed);
+    const std::uint64_t m = static_cast<std::uint64_t>(E);
+    std::vector<std::uint64_t> slots;
+
+    // Dense requests sample the (smaller) set of missing edges instead
+    const bool complement = m > N / 2;
+    if (complement) exactSlots(N, N - m, rng, slots);
+    else exactSlots(N, m, rng, slots);
+
+    Graph g(V, directed, m * (directed ? 1 : 2));
+    g.buildEdgeIndex(static_cast<int>(m));
+    addSlotEdges(g, slots, complement, rng);
     return g;
 }
 
+Graph Graph::generateRandomGraphGnp(int V, double p, std::uint64_t seed, bool directed) {
+    if (V <= 0) throw std::invalid_argument("V must be positive");
+    if (!(p >= 0.0 && p <= 1.0)) throw std::invalid_argument("p must be in [0, 1]");
+
+    std::mt19937_64 rng(seed);
+    const std::uint64_t N = slotCount(V, directed);
+    std::vector<std::uint64_t> slots;
+
+    // Same skipping either way; for p > 1/2 skip over the missing edges instead
+    const bool complement = p > 0.5;
+    bernoulliSlots(N, complement ? 1.0 - p : p, rng, slots);
+
+    const std::uint64_t edges = complement ? N - slots.size() : slots.size();
+    Graph g(V, directed, edges * (directed ? 1 : 2));
+    g.buildEdgeIndex(static_cast<int>(edges));
+    addSlotEdges(g, slots, complement, rng);
+    return g;
+}
 
+Graph Graph::fromRows(int V, bool directed, std::vector<std::vector<std::pair<int,int>>>& rows) {
+    std::size_t entries = 0;
+    for (const auto& row : rows) entries += row.size();
+    Graph g(V, directed, directed ? entries : 2 * entries);
+
+    if (directed) {
+        for (int u = 0; u < V; ++u) {
+            g.store->adj[u].assign(rows[u].begin(), rows[u].end()); // Into the arena, releasing the row as we go
+            std::vector<std::pair<int,int>>().swap(rows[u]);
+            g.store->outDeg[u] = static_cast<int>(g.store->adj[u].size());
+            for (const auto& neighbor : g.store->adj[u]) ++g.store->inDeg[neighbor.first];
+        }
+    } else {
+        // adj[x] = mirrored entries from rows u < x (ascending u), then row x itself
+        std::vector<int> mirrored(V, 0);
+        for (int u = 0; u < V; ++u) {
+            for (const auto& neighbor : rows[u]) ++mirrored[neighbor.first];
+        }
+        for (int x = 0; x < V; ++x) {
+            g.store->adj[x].reserve(mirrored[x] + rows[x].size());
+        }
+        for (int u = 0; u < V; ++u) {
+            for (const auto& neighbor : rows[u]) g.store->adj[neighbor.first].push_back({u, neighbor.second});
+        }
+        for (int x = 0; x < V; ++x) {
+            g.store->adj[x].insert(g.store->adj[x].end(), rows[x].begin(), rows[x].end());
+            std::vector<std::pair<int,int>>().swap(rows[x]);
+            g.store->outDeg[x] = g.store->inDeg[x] = static_cast<int>(g.store->adj[x].size());
+        }
+    }
+
+    g.buildEdgeIndex(0); // Sized from the entries now present
+    return g;
+}
+
+Graph Graph::relabel(const std::vector<int>& order) const {
+    if (order.size() != static_cast<std::size_t>(V))
+        throw std::invalid_argument("relabel: order must list all " + std::to_string(V) + " vertices");
+    std::vector<int> newId(V, -1); // Inverse permutation
+    for (int i = 0; i < V; ++i) {
+        if (order[i] < 0 || order[i] >= V || newId[order[i]] != -1)
+            throw std::invalid_argument("relabel: order is not a permutation");
+        newId[order[i]] = i;
+    }
+
+    Graph g(V, directed, countEntries());
+    g.store->labels.resize(V);
+    for (int i = 0; i < V; ++i) {
+        const int old = order[i];
+        g.store->labels[i] = originalId(old); // Relabeling twice still reports the very first ids
+        g.store->adj[i].reserve(store->adj[old].size());
+        for (const auto& neighbor : store->adj[old]) g.store->adj[i].push_back({newId[neighbor.first], neighbor.second});
+        g.store->inDeg[i] = store->inDeg[old];
+        g.store->outDeg[i] = store->outDeg[old];
+    }
+
+    g.buildEdgeIndex(0); // Sized from the entries now present
+    return g;
+}
+
+CsrGraph Graph::freeze() const {
+    return CsrGraph(*this);
+}
@@ -5,20 +5,159 @@
 #include <vector>
 #include <iostream>
 #include <utility> // For std::pair
+#include <string>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
 
+#include "EdgeIndex.hpp"
+#include "GraphArena.hpp"
+#include "Transpose.hpp"
 
+template <typename VId, typename W> class BasicCsrGraph;
+using CsrGraph = BasicCsrGraph<int, int>; // Same widths as Graph (see CsrGraph.hpp)
+
+// One adjacency list of a Graph: {neighbor, weight} pairs held in the graph's arena
+using AdjacencyRow = std::vector<std::pair<int,int>, ArenaAllocator<std::pair<int,int>>>;
+
+
+/**
+ * Copies are cheap snapshots: a copy shares the adjacency rows, edge index,
+ * degrees and labels with its source until one of them is modified
+ * (copy-on-write). The first edge change, buildEdgeIndex or dropEdgeIndex on
+ * a shared graph deep-copies that state into its own arena, so the other copies
+ * never see the change. Concurrent reads of shared copies need no locking.
+ */
 class Graph
 {
+    // Everything copies share; only detach() gives a Graph its own
+    struct Storage
+    {
+        std::unique_ptr<GraphArena> arena; // Slabs holding every adjacency row; declared before adj
+        std::vector<AdjacencyRow> adj; // Adjacency list representation
+        EdgeIndex edgeIndex; // O(1) membership for isEdgeConnected, kept in sync by addEdge
+        std::vector<int> inDeg; // In-degree per vertex, maintained by addEdge
+        std::vector<int> outDeg; // Out-degree per vertex, maintained by addEdge
+        std::vector<int> labels; // Original id of each vertex after relabel (empty = never relabeled)
+
+        Storage(int V, std::size_t expectedEntries, std::pmr::memory_resource* upstream);
+        Storage(const Storage& other); // Rows copied back to back into one exact-size slab
+
+        std::size_t entries() const;
+    };
+
     int V; // Number of vertices
     bool directed = false; // Directed or undirected graph												  
-    std::vector<std::vector<std::pair<int,int>>> adj; // Adjacency list representation
+    std::shared_ptr<Storage> store; // Shared with copies until one of them is modified
+    TransposeCache<int, int> transpose; // In-edges, built on first getInNeighbors and dropped by every edge change
+    std::uint64_t version = 0; // See getVersion
+
+    void detach(); // Deep-copy store if another Graph shares it; called before every mutation
+
+    // Unchecked edge changes on a detached store; callers validate and bump version
+    void link(int u, int v, int w);
+    void unlink(int u, int v);
+
+    // Hierholzer over half-edge IDs; appends the walk from start in reverse order
+    void hierholzer(int start, std::vector<int>& circuit) const;
+
+    // Start vertex of an Euler path that is not a circuit, or -1 if there is none
+    int eulerPathStart() const;
+
+    std::size_t countEntries() const; // Stored adjacency entries (undirected edges count twice)
+
+    // Assemble from duplicate-free rows sorted by neighbor. For undirected graphs rows[u]
+    // holds only neighbors v > u; the result equals calling addEdge in (u, v) order.
+    static Graph fromRows(int V, bool directed, std::vector<std::vector<std::pair<int,int>>>& rows);
 
     public:
-        Graph(int V, bool directed);
+        struct Edge
+        {
+            int u, v, w;
+        };
+
+        // Edge insertions and removals that applyBatch validates and applies together, in order
+        class EdgeBatch
+        {
+            public:
+                struct Update
+                {
+                    int u, v, w;
+                    bool insert; // false: remove u -> v (w unused)
+                };
+
+                void insert(int u, int v, int w = 0) { updates.push_back({u, v, w, true}); }
+
+                void remove(int u, int v) { updates.push_back({u, v, 0, false}); }
+
+                std::size_t size() const { return updates.size(); }
+
+                bool empty() const { return updates.empty(); }
+
+                void clear() { updates.clear(); }
+
+                const std::vector<Update>& getUpdates() const { return updates; } // In the order they apply
+
+            private:
+                std::vector<Update> updates;
+        };
+
+        // What fromEdges does when the same edge appears more than once
+        enum class DuplicatePolicy { KeepFirst, KeepLast, KeepMinWeight };
+
+        // Per-reason rejection counts, reported once instead of one std::cerr line per edge
+        struct LoadReport
+        {
+            std::size_t accepted = 0;
+            std::size_t outOfRange = 0;
+            std::size_t negativeWeight = 0;
+            std::size_t selfLoops = 0;
+            std::size_t duplicates = 0;
+
+            std::size_t rejected() const { return outOfRange + negativeWeight + selfLoops + duplicates; }
+        };
+
+        // expectedEntries sizes the first arena slab (adjacency entries; an undirected edge is two).
+        // upstream supplies the slabs: the process default resource unless another is plugged in.
+        Graph(int V, bool directed, std::size_t expectedEntries = 0,
+              std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+        // O(1): the copy shares the source's storage until either one is modified
+        Graph(const Graph& other) = default;
+        Graph(Graph&& other) = default;
+
+        Graph& operator=(const Graph& other) = default;
+        Graph& operator=(Graph&& other) = default;
+
+        // Bulk build: counting (radix) sort by source, then one pass dropping duplicates and
+        // self-loops. Neighbor order matches calling addEdge on the edges in input order.
+        static Graph fromEdges(int V, const Edge* edges, std::size_t count, bool directed,
+                               DuplicatePolicy policy = DuplicatePolicy::KeepFirst, LoadReport* report = nullptr);
+
+        static Graph fromEdges(int V, const std::vector<Edge>& edges, bool directed,
+                               DuplicatePolicy policy = DuplicatePolicy::KeepFirst, LoadReport* report = nullptr);
 
         void addEdge(int u, int v, int w = 0);
 
-        const std::vector<std::pair<int, int>>& getNeighbors(int v) const;
+        // Both directions of an undirected edge; the other neighbors keep their order
+        void removeEdge(int u, int v);
+
+        // All updates or none: throws std::invalid_argument naming the first update that
+        // is invalid at its point in the batch (bad vertex or weight, self-loop, inserting
+        // an existing edge, removing a missing one), leaving the graph unchanged.
+        // Copies taken before the call keep the old edges (see the class comment).
+        void applyBatch(const EdgeBatch& batch);
+
+        // Bumped by every addEdge and removeEdge and once per non-empty applyBatch. Copies
+        // keep it, so a snapshot and its source agree on it until the source changes.
+        std::uint64_t getVersion() const { return version; }
+
+        const AdjacencyRow& getNeighbors(int v) const;
+
+        using InNeighborRange = SoaNeighborRange<int, int>;
+
+        // {u, weight} for every edge u -> v, u ascending. Valid until the next edge change.
+        InNeighborRange getInNeighbors(int v) const;
 
         bool isDirected() const;
 
@@ -26,6 +165,12 @@ class Graph
 
         bool isEdgeConnected(int u, int v) const;
 
+        // Rebuild the edge index for an expected number of edges (picks bit matrix or hash set)
+        void buildEdgeIndex(int expectedEdges);
+
+        // Free the edge index; isEdgeConnected falls back to scanning adj[u]
+        void dropEdgeIndex();
+
         void printGraph() const;
 
         int degree(int v) const;
@@ -34,12 +179,41 @@ class Graph
     
         int get_out_degree(int v) const;
 
+        bool hasEulerianDegrees() const; // Single O(V) pass: in == out (directed) or all even (undirected)
+
         bool isEulerian() const;
 
         void findEulerCircuit();
 
+        bool hasEulerPath() const; // Exactly two odd (or unbalanced) vertices and connected
+
+        void findEulerPath();
+
         static Graph generateRandomGraph(int V, int E, int seed, bool directed = false);
 
+        // Seeded, sampling without replacement, O(V + E) at any density (mt19937_64, reproducible per seed)
+        static Graph generateRandomGraphGnm(int V, long long E, std::uint64_t seed, bool directed = false); // Exactly E edges
+
+        static Graph generateRandomGraphGnp(int V, double p, std::uint64_t seed, bool directed = false); // Each edge with probability p
+
+        // Exactly E edges, rows sampled in parallel on Philox streams; identical for any thread count (0 = all cores)
+        static Graph generateRandomGraphParallel(int V, long long E, std::uint64_t seed, bool directed = false, int threads = 0);
+
+        // Copy with vertex order[i] renamed to i (order is a permutation, e.g. from Reorder.hpp).
+        // Neighbor order is kept; throws std::invalid_argument if order is not a permutation of 0..V-1.
+        Graph relabel(const std::vector<int>& order) const;
+
+        // Id of v before any relabel; algorithms report results in these ids
+        int originalId(int v) const { return store->labels.empty() ? v : store->labels[v]; }
+
+        bool isRelabeled() const { return !store->labels.empty(); }
+
+        CsrGraph freeze() const; // Contiguous read-only snapshot (see CsrGraph.hpp)
+
+        void save(const std::string& path) const; // Binary CSR file; open it with MappedGraph (see GraphFile.hpp). Stores the current ids, not original ones
+
+        static Graph load(const std::string& path); // Mutable copy of a file written by save
+
         
 };
 #endif
@@ -0,0 +1,79 @@
+#ifndef GRAPH_ARENA_HPP
+#define GRAPH_ARENA_HPP
+
+#include <memory_resource>
+#include <type_traits>
+#include <algorithm>
+#include <cstddef>
+
+/**
+ * @brief Slab storage for the adjacency rows of one Graph.
+ *
+ * Rows are bump-allocated from a few large slabs (std::pmr::monotonic_buffer_resource)
+ * taken from an upstream memory resource: the process default unless another
+ * one is plugged in, e.g. a pool or a pre-reserved buffer. Nothing is freed
+ * per row; all slabs go back to the upstream together when the Graph is
+ * destroyed. Bulk builders and copies size the first slab for every entry, so
+ * their rows are packed back to back in one slab. A row grown by addEdge
+ * leaves its previous block behind (at most the row's final size, since rows
+ * double).
+ */
+class GraphArena
+{
+    std::pmr::monotonic_buffer_resource slabs;
+
+    public:
+        static constexpr std::size_t kMinSlabBytes = 64 * 1024;
+
+        explicit GraphArena(std::size_t firstSlabBytes = 0,
+                            std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : slabs(std::max(firstSlabBytes, kMinSlabBytes), upstream) {}
+
+        GraphArena(const GraphArena&) = delete;
+        GraphArena& operator=(const GraphArena&) = delete;
+
+        void* allocate(std::size_t bytes, std::size_t align) { return slabs.allocate(bytes, align); }
+
+        std::pmr::memory_resource* upstream() const { return slabs.upstream_resource(); }
+};
+
+/**
+ * @brief Allocator handing out GraphArena memory to standard containers.
+ *
+ * deallocate() is a no-op, so a container may outlive its arena's slabs (e.g.
+ * during Graph's move assignment) without touching freed memory. The
+ * allocator follows the container on move and swap, which keeps moved rows
+ * pointing at the arena that holds them.
+ */
+template <typename T>
+class ArenaAllocator
+{
+    template <typename U> friend class ArenaAllocator;
+
+    GraphArena* arena;
+
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        explicit ArenaAllocator(GraphArena* arena) noexcept : arena(arena) {}
+
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+        T* allocate(std::size_t n) { return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T))); }
+
+        void deallocate(T*, std::size_t) noexcept {} // Released with the whole arena
+
+        GraphArena* resource() const noexcept { return arena; }
+
+        template <typename U>
+        bool operator==(const ArenaAllocator<U>& other) const noexcept { return arena == other.arena; }
+
+        template <typename U>
+        bool operator!=(const ArenaAllocator<U>& other) const noexcept { return arena != other.arena; }
+};
+
+#endif
@@ -0,0 +1,229 @@
+
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "Graph.hpp"
+#include "GraphFile.hpp"
+
+
+static const char kMagic[8] = {'G', 'R', 'A', 'P', 'H', 'C', 'S', 'R'};
+
+static std::uint64_t alignUp(std::uint64_t pos)
+{
+    return (pos + 7) & ~std::uint64_t(7);
+}
+
+static std::runtime_error systemError(const std::string& what, const std::string& path)
+{
+    return std::runtime_error(what + " '" + path + "': " + std::strerror(errno));
+}
+
+// ---------- Writing ----------
+
+void Graph::save(const std::string& path) const {
+    std::uint64_t entries = countEntries();
+
+    GraphFileHeader h{};
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.version = GraphFileHeader::kVersion;
+    h.flags = directed ? GraphFileHeader::kDirected : 0;
+    h.byteOrder = GraphFileHeader::kByteOrder;
+    h.numVertices = static_cast<std::uint64_t>(V);
+    h.numEntries = entries;
+    h.offsetsPos = sizeof(GraphFileHeader);
+    h.targetsPos = alignUp(h.offsetsPos + (h.numVertices + 1) * sizeof(std::uint64_t));
+    h.weightsPos = alignUp(h.targetsPos + entries * sizeof(std::int32_t));
+
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) throw systemError("cannot create", path);
+
+    bool ok = true;
+    std::uint64_t pos = 0;
+    auto put = [&](const void* data, std::size_t bytes) {
+        if (ok && bytes > 0 && std::fwrite(data, 1, bytes, f) != bytes) ok = false;
+        pos += bytes;
+    };
+    auto padTo = [&](std::uint64_t target) {
+        static const char zeros[8] = {0};
+        put(zeros, static_cast<std::size_t>(target - pos));
+    };
+
+    put(&h, sizeof(h));
+
+    std::vector<std::uint64_t> offsets(V + 1, 0);
+    for (int u = 0; u < V; ++u) offsets[u + 1] = offsets[u] + store->adj[u].size();
+    put(offsets.data(), offsets.size() * sizeof(std::uint64_t));
+
+    // Targets and weights are written row by row through one reusable buffer
+    std::vector<std::int32_t> buffer;
+    padTo(h.targetsPos);
+    for (const auto& row : store->adj) {
+        buffer.clear();
+        for (const auto& neighbor : row) buffer.push_back(neighbor.first);
+        put(buffer.data(), buffer.size() * sizeof(std::int32_t));
+    }
+    padTo(h.weightsPos);
+    for (const auto& row : store->adj) {
+        buffer.clear();
+        for (const auto& neighbor : row) buffer.push_back(neighbor.second);
+        put(buffer.data(), buffer.size() * sizeof(std::int32_t));
+    }
+
+    if (std::fclose(f) != 0) ok = false;
+    if (!ok) throw systemError("cannot write", path);
+}
+
+// ---------- Mapping ----------
+
+MappedGraph::MappedGraph(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw systemError("cannot open", path);
+
+    struct stat st;
+    if (::fstat(fd, &st) < 0) {
+        std::runtime_error err = systemError("cannot stat", path);
+        ::close(fd);
+        throw err;
+    }
+    length = static_cast<std::size_t>(st.st_size);
+    if (length < sizeof(GraphFileHeader)) {
+        ::close(fd);
+        throw std::invalid_argument("not a graph file (too short): " + path);
+    }
+
+    base = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (base == MAP_FAILED) {
+        base = nullptr;
+        std::runtime_error err = systemError("cannot map", path);
+        ::close(fd);
+        throw err;
+    }
+    ::close(fd); // The mapping keeps the file alive
+
+    auto fail = [&](const std::string& why) {
+        ::munmap(base, length);
+        base = nullptr;
+        throw std::invalid_argument("invalid graph file '" + path + "': " + why);
+    };
+
+    const GraphFileHeader& h = *static_cast<const GraphFileHeader*>(base);
+    const std::uint64_t size = length;
+    if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0) fail("bad magic");
+    if (h.version != GraphFileHeader::kVersion) fail("unsupported version " + std::to_string(h.version));
+    if (h.byteOrder != GraphFileHeader::kByteOrder) fail("written with a different byte order");
+    if (h.numVertices > 0x7FFFFFFFull) fail("too many vertices");
+    if (h.offsetsPos % 8 || h.targetsPos % 8 || h.weightsPos % 8) fail("misaligned section");
+    if (h.offsetsPos > size || (size - h.offsetsPos) / sizeof(std::uint64_t) < h.numVertices + 1) fail("truncated offsets");
+    if (h.targetsPos > size || (size - h.targetsPos) / sizeof(std::int32_t) < h.numEntries) fail("truncated targets");
+    if (h.weightsPos > size || (size - h.weightsPos) / sizeof(std::int32_t) < h.numEntries) fail("truncated weights");
+
+    const char* bytes = static_cast<const char*>(base);
+    V = static_cast<int>(h.numVertices);
+    directed = (h.flags & GraphFileHeader::kDirected) != 0;
+    offsets = reinterpret_cast<const std::uint64_t*>(bytes + h.offsetsPos);
+    targets = reinterpret_cast<const int*>(bytes + h.targetsPos);
+    weights = reinterpret_cast<const int*>(bytes + h.weightsPos);
+
+    // O(V): every row must lie inside the target section
+    if (offsets[0] != 0 || offsets[V] != h.numEntries) fail("offsets do not cover the entries");
+    for (int u = 0; u < V; ++u) {
+        if (offsets[u + 1] < offsets[u]) fail("offsets are not ascending");
+    }
+
+    // O(E), one sequential pass: the algorithms index their per-vertex arrays by target id
+    for (int u = 0; u < V; ++u) {
+        for (std::uint64_t i = offsets[u]; i < offsets[u + 1]; ++i) {
+            if (targets[i] < 0 || targets[i] >= V || weights[i] < 0) fail("bad entry in row " + std::to_string(u));
+        }
+    }
+}
+
+MappedGraph::~MappedGraph() {
+    if (base) ::munmap(base, length);
+}
+
+MappedGraph::NeighborRange MappedGraph::getNeighbors(int v) const {
+    if (v < 0 || v >= V)
+    {
+        std::cerr << "Error: Vertex out of bounds (getNeighbors)" << std::endl;
+        return NeighborRange(nullptr, nullptr, 0);
+    }
+    return NeighborRange(targets + offsets[v], weights + offsets[v],
+                         static_cast<std::size_t>(offsets[v + 1] - offsets[v]));
+}
+
+MappedGraph::NeighborRange MappedGraph::getInNeighbors(int v) const {
+    if (v < 0 || v >= V)
+    {
+        std::cerr << "Error: Vertex out of bounds (getInNeighbors)" << std::endl;
+        return NeighborRange(nullptr, nullptr, 0);
+    }
+    return transpose.get(*this).in(v);
+}
+
+bool MappedGraph::isEdgeConnected(int u, int v) const {
+    if (u < 0 || u >= V || v < 0 || v >= V)
+    {
+        std::cerr << "Error: Vertex out of bounds (isConnected)" << std::endl;
+        return false;
+    }
+    for (const int* t = targetsBegin(u); t != targetsEnd(u); ++t)
+    {
+        if (*t == v)
+            return true;
+    }
+    return false;
+}
+
+int MappedGraph::get_out_degree(int v) const {
+    if (v < 0 || v >= V)
+    {
+        std::cerr << "Error: Vertex out of bounds (out_degree)" << std::endl;
+        return -1;
+    }
+    return static_cast<int>(offsets[v + 1] - offsets[v]);
+}
+
+int MappedGraph::get_in_degree(int v) const {
+    if (v < 0 || v >= V)
+    {
+        std::cerr << "Error: Vertex out of bounds (in_degree)" << std::endl;
+        return -1;
+    }
+    return transpose.get(*this).inDegree(v);
+}
+
+// ---------- Loading into a mutable Graph ----------
+
+Graph Graph::load(const std::string& path) {
+    MappedGraph file(path);
+    const int n = file.getNumVertices();
+    Graph g(n, file.isDirected(), static_cast<std::size_t>(file.getNumEdges()));
+
+    std::vector<int> seenIn(n, -1); // Row in which each target was last seen
+    for (int u = 0; u < n; ++u) {
+        AdjacencyRow& row = g.store->adj[u];
+        row.reserve(file.get_out_degree(u));
+        for (const auto& neighbor : file.getNeighbors(u)) {
+            if (neighbor.first < 0 || neighbor.first >= n || neighbor.first == u || neighbor.second < 0 ||
+                seenIn[neighbor.first] == u)
+                throw std::invalid_argument("invalid graph file '" + path + "': bad entry in row " + std::to_string(u));
+            seenIn[neighbor.first] = u;
+            row.push_back(neighbor);
+            ++g.store->inDeg[neighbor.first];
+        }
+        g.store->outDeg[u] = static_cast<int>(row.size());
+    }
+
+    g.buildEdgeIndex(0); // Sized from the entries now present
+    return g;
+}
@@ -0,0 +1,95 @@
+#ifndef GRAPH_FILE_HPP
+#define GRAPH_FILE_HPP
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+#include "CsrGraph.hpp"
+
+/**
+ * @brief On-disk binary graph format (version 1), written by Graph::save.
+ *
+ * Layout, all integers in native (little-endian) byte order:
+ *   GraphFileHeader                  64 bytes
+ *   offsets  uint64_t[V + 1]         at header.offsetsPos
+ *   targets  int32_t[numEntries]     at header.targetsPos
+ *   weights  int32_t[numEntries]     at header.weightsPos
+ * Every section starts on an 8-byte boundary. Rows are stored exactly like
+ * Graph's adjacency lists (insertion order; undirected edges in both rows),
+ * so a mapped file behaves like the Graph that was saved.
+ */
+struct GraphFileHeader
+{
+    char magic[8];            // "GRAPHCSR"
+    std::uint32_t version;    // kVersion
+    std::uint32_t flags;      // Bit 0: directed
+    std::uint32_t byteOrder;  // kByteOrder as written by the saving machine
+    std::uint32_t reserved;   // Zero
+    std::uint64_t numVertices;
+    std::uint64_t numEntries; // Stored adjacency entries (directed half-edges)
+    std::uint64_t offsetsPos; // Byte offsets of the three sections
+    std::uint64_t targetsPos;
+    std::uint64_t weightsPos;
+
+    static constexpr std::uint32_t kVersion = 1;
+    static constexpr std::uint32_t kByteOrder = 0x01020304;
+    static constexpr std::uint32_t kDirected = 1;
+};
+
+static_assert(sizeof(GraphFileHeader) == 64, "GraphFileHeader must stay 64 bytes");
+
+/**
+ * @brief Read-only view of a graph file through mmap: opening is one scan, no parsing.
+ *
+ * Opening validates the header, the offsets and every entry (target id in
+ * [0, V), weight >= 0), so a corrupt file is rejected before any algorithm
+ * indexes by its ids. Graph::load also rejects self-loops and repeated targets
+ * when a mutable copy is needed. Exposes the same read interface as
+ * CsrGraph, so every algorithm runs on it directly. Throws std::runtime_error if
+ * the file cannot be mapped and std::invalid_argument if it is not a valid graph file.
+ */
+class MappedGraph
+{
+    void* base = nullptr;     // Start of the mapping
+    std::size_t length = 0;   // Mapped bytes
+    int V = 0;
+    bool directed = false;
+    const std::uint64_t* offsets = nullptr;
+    const int* targets = nullptr;
+    const int* weights = nullptr;
+    TransposeCache<int, int> transpose; // In-edges, built on first use (in memory, not in the file)
+
+    public:
+        using NeighborIterator = CsrGraph::NeighborIterator;
+        using NeighborRange = CsrGraph::NeighborRange;
+
+        explicit MappedGraph(const std::string& path);
+        ~MappedGraph();
+
+        MappedGraph(const MappedGraph&) = delete;
+        MappedGraph& operator=(const MappedGraph&) = delete;
+
+        NeighborRange getNeighbors(int v) const;
+
+        NeighborRange getInNeighbors(int v) const; // {u, weight} for every edge u -> v, u ascending
+
+        const int* targetsBegin(int v) const { return targets + offsets[v]; }
+        const int* targetsEnd(int v) const { return targets + offsets[v + 1]; }
+
+        bool isDirected() const { return directed; }
+
+        int getNumVertices() const { return V; }
+
+        int originalId(int v) const { return v; } // Files keep the ids they were saved with
+
+        long long getNumEdges() const { return static_cast<long long>(offsets[V]); } // Stored (directed) adjacency entries
+
+        bool isEdgeConnected(int u, int v) const; // Scans row u; there is no edge index on a mapped file
+
+        int get_out_degree(int v) const;
+
+        int get_in_degree(int v) const;
+};
+
+#endif
@@ -3,56 +3,49 @@
 
 #include "Algorithms.hpp"               // Base interface for algorithms (declares virtual run)
 #include "Graph.hpp"                    // Graph API: adjacency, neighbors, vertex count, etc.
+#include "BitsetGraph.hpp"              // Adjacency bit matrix used by the search
 #include <vector>                       // std::vector container
 #include <sstream>                      // std::ostringstream for building string output
+#include <cstdint>                      // std::uint64_t bitset words
 
 class Hamilton : public Algorithms { // Concrete algorithm class deriving from Algorithms
 private:
     std::vector<int> path;              // Stores a found Hamiltonian circuit (ordering of vertices)
     bool found;                         // Flag indicating whether a Hamiltonian circuit was found
     
-    bool isSafe(int v, const Graph& g, const std::vector<int>& currentPath, int pos) {
-        // Checks if vertex 'v' can be placed at position 'pos' in 'currentPath'
-        
-        // Ensure 'v' is adjacent to the previously placed vertex (to maintain a path)
-        if (pos > 0 && !g.isEdgeConnected(currentPath[pos - 1], v)) {
-            return false;               // Not adjacent → cannot place 'v' here
-        }
-        
-        // Ensure 'v' does not already appear earlier in the path (no repeated vertices)
-        for (int i = 0; i < pos; i++) {
-            if (currentPath[i] == v) {
-                return false;           // Duplicate vertex → not safe
-            }
-        }
-        
-        return true;                    // Passed all checks → safe to place 'v'
-    }
-    
-    bool hamiltonianUtil(const Graph& g, std::vector<int>& currentPath, int pos) {
-        int V = g.getNumVertices();     // Number of vertices in the graph
+    // Backtracking over the adjacency bitsets: the candidates for position 'pos' are the
+    // neighbors of the previous vertex that are not on the path yet, one word at a time
+    bool hamiltonianUtil(const BitsetGraph& adj, std::vector<int>& currentPath, std::vector<std::uint64_t>& used, int pos) {
+        int V = adj.getNumVertices();   // Number of vertices in the graph
         
         // Base case: all positions are filled with vertices (a Hamiltonian path candidate)
         if (pos == V) {
             // To be a circuit, last vertex must connect back to the first
-            if (g.isEdgeConnected(currentPath[pos - 1], currentPath[0])) {
+            if (adj.isEdgeConnected(currentPath[pos - 1], currentPath[0])) {
                 path = currentPath;     // Save the completed Hamiltonian circuit
                 return true;            // Signal success
             }
             return false;               // Not a circuit (no closing edge) → fail this branch
         }
         
-        // Try every vertex as a candidate for the next position in the path
-        for (int v = 0; v < V; v++) {
-            if (isSafe(v, g, currentPath, pos)) { // Check placement constraints
+        // Try the candidates in ascending order, like a scan over v = 0 .. V-1 would
+        const std::uint64_t* next = adj.row(currentPath[pos - 1]);
+        for (std::size_t i = 0; i < adj.wordsPerRow(); ++i) {
+            std::uint64_t candidates = next[i] & ~used[i]; // Adjacent to the previous vertex and not used yet
+            while (candidates) {
+                int v = static_cast<int>(i * 64) + __builtin_ctzll(candidates);
+                candidates &= candidates - 1;
+                
                 currentPath[pos] = v;  // Place vertex 'v' at position 'pos'
+                BitsetGraph::set(used.data(), v);
                 
                 // Recurse to place the next vertex
-                if (hamiltonianUtil(g, currentPath, pos + 1)) {
+                if (hamiltonianUtil(adj, currentPath, used, pos + 1)) {
                     return true;       // If any branch succeeds, bubble up success
                 }
                 
                 // Backtrack: undo placement at 'pos' and try another vertex
+                BitsetGraph::reset(used.data(), v);
                 currentPath[pos] = -1;
             }
         }
@@ -60,8 +53,48 @@ private:
         return false;                   // Exhausted all candidates for this 'pos' → no solution here
     }
 
-public:
-    std::string run(Graph& g) override { // Entry point defined by the Algorithms interface
+    // Same search over sorted neighbor lists, for graphs too large for the bit matrix.
+    // Iterative (one cursor per position), so a long path cannot overflow the stack.
+    bool hamiltonianSparse(const SortedAdjacency& adj, std::vector<int>& currentPath) {
+        int V = adj.getNumVertices();   // Number of vertices in the graph
+        std::vector<char> used(V, 0);   // Vertices already on the path
+        std::vector<const int*> cursor(V, nullptr); // Next neighbor to try at each position
+        used[currentPath[0]] = 1;
+        
+        int pos = 1;
+        if (V > 1) cursor[1] = adj.begin(currentPath[0]);
+        while (pos > 0) {
+            if (pos == V) {
+                // To be a circuit, last vertex must connect back to the first
+                if (adj.isEdgeConnected(currentPath[pos - 1], currentPath[0])) {
+                    path = currentPath; // Save the completed Hamiltonian circuit
+                    return true;
+                }
+                --pos;                  // Backtrack from the full path
+                used[currentPath[pos]] = 0;
+                continue;
+            }
+            
+            const int* end = adj.end(currentPath[pos - 1]);
+            while (cursor[pos] != end && used[*cursor[pos]]) ++cursor[pos]; // Skip vertices already used
+            if (cursor[pos] == end) {
+                currentPath[pos] = -1;  // No candidate left for 'pos' → backtrack
+                --pos;
+                if (pos > 0) used[currentPath[pos]] = 0;
+                continue;
+            }
+            
+            int v = *cursor[pos]++;     // Place the next candidate at 'pos'
+            currentPath[pos] = v;
+            used[v] = 1;
+            ++pos;
+            if (pos < V) cursor[pos] = adj.begin(v);
+        }
+        return false;                   // Every branch failed
+    }
+
+    template <typename G>
+    std::string solve(const G& g) {     // Shared body for Graph and the CSR snapshots
         int V = g.getNumVertices();     // Get vertex count
         
         if (V == 0) {                   // Handle empty graph edge-case
@@ -75,8 +108,13 @@ public:
         // Fix the start of the path at vertex 0 (symmetry breaking to reduce duplicates)
         currentPath[0] = 0;
         
-        if (hamiltonianUtil(g, currentPath, 1)) { // Start search from position 1
-            found = true;              // Mark success if a circuit was found
+        if (BitsetGraph::fits(V)) {
+            BitsetGraph adj(g);        // Adjacency tests and candidate sets become word operations
+            std::vector<std::uint64_t> used(adj.wordsPerRow(), 0); // Vertices already on the path
+            BitsetGraph::set(used.data(), 0);
+            found = hamiltonianUtil(adj, currentPath, used, 1); // Start search from position 1
+        } else {
+            found = hamiltonianSparse(SortedAdjacency(g), currentPath); // V^2 bits would not fit
         }
         
         std::ostringstream result;     // Prepare textual result
@@ -84,10 +122,10 @@ public:
             result << "Hamilton Circuit found:\n"; // Header line
             result << "Path: ";        // Label for the path
             for (int i = 0; i < V; i++) {
-                result << path[i];     // Output each vertex in order
+                result << g.originalId(path[i]); // Output each vertex in order (ids before any relabel)
                 if (i < V - 1) result << " -> "; // Arrow between vertices
             }
-            result << " -> " << path[0] << "\n"; // Close the cycle by returning to start
+            result << " -> " << g.originalId(path[0]) << "\n"; // Close the cycle by returning to start
             
             // Optionally compute total weight (if the graph stores positive weights)
             int totalWeight = 0;       // Accumulates total edge weight along the circuit
@@ -115,6 +153,9 @@ public:
         
         return result.str();           // Return the assembled result string
     }
+
+public:
+    std::string run(GraphView g) override { return std::visit([this](auto graph) { return solve(*graph); }, g); } // Entry point defined by the Algorithms interface
 };
 
 #endif                                   // End of include guard
@@ -0,0 +1,311 @@
+#ifndef INCREMENTAL_MST_HPP
+#define INCREMENTAL_MST_HPP
+
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <utility>
+#include <limits>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+#include "Graph.hpp"
+#include "MST.hpp"
+
+/**
+ * @brief A minimum spanning forest kept up to date while its graph grows.
+ *
+ * The forest lives in a link-cut tree in which every tree edge is a node of its
+ * own, keyed by its weight, so the heaviest edge on the tree path u..v is one
+ * path query. Inserting u -> v with weight w costs O(log V) amortized:
+ * - u and v in different trees: the edge links them;
+ * - otherwise, by the cycle property, it replaces the heaviest edge on the
+ *   path u..v if that edge is strictly heavier, and is dropped if not.
+ * Removing a non-tree edge is free. Removing a tree edge would need a search
+ * for the lightest replacement among all edges, so a batch that does so ends
+ * with rebuild(): a full Kruskal over the graph, O(E log E), not polylogarithmic.
+ * Workloads that delete tree edges often gain nothing over recomputing.
+ *
+ * Only the forest is stored: the caller keeps the graph, applies each batch to
+ * it and passes the result to apply(), which reads it only to rebuild.
+ * The server keeps one per named graph, next to its VersionedGraph, and reports
+ * it for "-a MST" requests.
+ */
+class IncrementalMST
+{
+    // Splay-based link-cut tree over nodes 1..n (0 is the null node) with path maximum.
+    // Vertex nodes carry kVertexKey, so a path maximum is always an edge node.
+    class LinkCutTree
+    {
+        struct Node
+        {
+            int child[2] = {0, 0};
+            int parent = 0; // Splay parent, or path-parent for the root of a splay tree
+            bool flip = false; // Children of this subtree still to be swapped
+            long long key = kVertexKey;
+            int best = 0; // Node with the largest key in this splay subtree
+        };
+        std::vector<Node> t;
+        std::vector<int> path; // Scratch for splay
+
+        bool isSplayRoot(int x) const
+        {
+            int p = t[x].parent;
+            return p == 0 || (t[p].child[0] != x && t[p].child[1] != x);
+        }
+
+        void pull(int x)
+        {
+            int best = x;
+            for (int c : t[x].child) {
+                if (c != 0 && t[t[c].best].key > t[best].key) best = t[c].best;
+            }
+            t[x].best = best;
+        }
+
+        void push(int x)
+        {
+            if (!t[x].flip) return;
+            std::swap(t[x].child[0], t[x].child[1]);
+            for (int c : t[x].child) {
+                if (c != 0) t[c].flip = !t[c].flip;
+            }
+            t[x].flip = false;
+        }
+
+        void rotate(int x)
+        {
+            int p = t[x].parent, g = t[p].parent;
+            int side = t[p].child[1] == x ? 1 : 0;
+            if (!isSplayRoot(p)) t[g].child[t[g].child[1] == p ? 1 : 0] = x;
+            t[x].parent = g;
+            t[p].child[side] = t[x].child[side ^ 1];
+            if (t[x].child[side ^ 1] != 0) t[t[x].child[side ^ 1]].parent = p;
+            t[x].child[side ^ 1] = p;
+            t[p].parent = x;
+            pull(p);
+            pull(x);
+        }
+
+        void splay(int x)
+        {
+            path.clear();
+            for (int y = x; ; y = t[y].parent) {
+                path.push_back(y);
+                if (isSplayRoot(y)) break;
+            }
+            for (auto it = path.rbegin(); it != path.rend(); ++it) push(*it);
+
+            while (!isSplayRoot(x)) {
+                int p = t[x].parent, g = t[p].parent;
+                if (!isSplayRoot(p)) rotate((t[g].child[0] == p) == (t[p].child[0] == x) ? p : x);
+                rotate(x);
+            }
+        }
+
+        // Make the root..x path preferred; x ends up as the root of its splay tree
+        void access(int x)
+        {
+            for (int last = 0, y = x; y != 0; last = y, y = t[y].parent) {
+                splay(y);
+                t[y].child[1] = last;
+                pull(y);
+            }
+            splay(x);
+        }
+
+        void makeRoot(int x)
+        {
+            access(x);
+            t[x].flip = !t[x].flip;
+        }
+
+        int findRoot(int x)
+        {
+            access(x);
+            for (;;) {
+                push(x);
+                if (t[x].child[0] == 0) break;
+                x = t[x].child[0];
+            }
+            splay(x);
+            return x;
+        }
+
+    public:
+        static constexpr long long kVertexKey = std::numeric_limits<long long>::min();
+
+        explicit LinkCutTree(int n) : t(static_cast<std::size_t>(n) + 1)
+        {
+            for (int x = 0; x <= n; ++x) t[x].best = x;
+        }
+
+        // Node n + 1, isolated, with the given key
+        int addNode(long long key)
+        {
+            t.emplace_back();
+            int x = static_cast<int>(t.size()) - 1;
+            t[x].key = key;
+            t[x].best = x;
+            return x;
+        }
+
+        // Caller guarantees x is isolated (freshly cut)
+        void setKey(int x, long long key)
+        {
+            t[x].key = key;
+            t[x].best = x;
+        }
+
+        long long keyOf(int x) const { return t[x].key; }
+
+        bool connected(int x, int y) { return x == y || findRoot(x) == findRoot(y); }
+
+        // Caller guarantees x and y are in different trees
+        void link(int x, int y)
+        {
+            makeRoot(x);
+            t[x].parent = y;
+        }
+
+        // Caller guarantees x and y are adjacent
+        void cut(int x, int y)
+        {
+            makeRoot(x);
+            access(y);
+            t[y].child[0] = 0;
+            t[x].parent = 0;
+            pull(y);
+        }
+
+        // Node with the largest key on the path x..y (same tree)
+        int pathMax(int x, int y)
+        {
+            makeRoot(x);
+            access(y);
+            return t[y].best;
+        }
+    };
+
+    struct TreeEdge
+    {
+        int u, v, weight;
+    };
+
+    int V;
+    LinkCutTree forest;
+    std::vector<TreeEdge> edgeAt;   // Tree edge held by edge node V + 1 + i
+    std::vector<int> freeNodes;     // Edge nodes not in the forest, for reuse
+    std::unordered_map<std::uint64_t, int> nodeOf; // Tree edge {min, max} -> its node
+    long long totalWeight = 0;
+    int components;
+
+    static std::uint64_t pairKey(int u, int v)
+    {
+        if (u > v) std::swap(u, v);
+        return (static_cast<std::uint64_t>(u) << 32) | static_cast<std::uint32_t>(v);
+    }
+
+    void linkEdge(int u, int v, int w)
+    {
+        int e;
+        if (!freeNodes.empty()) {
+            e = freeNodes.back();
+            freeNodes.pop_back();
+            forest.setKey(e, w);
+            edgeAt[e - V - 1] = {u, v, w};
+        } else {
+            e = forest.addNode(w);
+            edgeAt.push_back({u, v, w});
+        }
+        forest.link(u + 1, e);
+        forest.link(e, v + 1);
+        nodeOf[pairKey(u, v)] = e;
+        totalWeight += w;
+        --components;
+    }
+
+    void cutEdge(int e)
+    {
+        const TreeEdge edge = edgeAt[e - V - 1];
+        forest.cut(edge.u + 1, e);
+        forest.cut(e, edge.v + 1);
+        nodeOf.erase(pairKey(edge.u, edge.v));
+        freeNodes.push_back(e);
+        totalWeight -= edge.weight;
+        ++components;
+    }
+
+    void insert(int u, int v, int w)
+    {
+        if (!forest.connected(u + 1, v + 1)) {
+            linkEdge(u, v, w);
+            return;
+        }
+        int heaviest = forest.pathMax(u + 1, v + 1);
+        if (forest.keyOf(heaviest) > w) { // Cycle property: the heaviest cycle edge leaves the forest
+            cutEdge(heaviest);
+            linkEdge(u, v, w);
+        }
+    }
+
+    void rebuild(const Graph& g)
+    {
+        forest = LinkCutTree(V);
+        edgeAt.clear();
+        freeNodes.clear();
+        nodeOf.clear();
+        totalWeight = 0;
+        components = V;
+        for (const MST::Edge& e : MST::spanningForest(g)) linkEdge(e.u, e.v, e.weight);
+    }
+
+public:
+    // The minimum spanning forest of g. Throws std::invalid_argument for a directed graph
+    explicit IncrementalMST(const Graph& g) : V(g.getNumVertices()), forest(V), components(V)
+    {
+        if (g.isDirected()) throw std::invalid_argument("IncrementalMST: graph must be undirected");
+        rebuild(g);
+    }
+
+    // Moves the forest to the graph after the batch, which the caller has already applied
+    // (Graph::applyBatch validated it); after is that graph, only read to rebuild.
+    // O(log V) amortized per insertion; O(E log E) in all if the batch removes a tree edge.
+    // If this throws (out of memory) the forest is unusable: apply to a copy to keep the old one.
+    void apply(const Graph::EdgeBatch& batch, const Graph& after)
+    {
+        if (after.getNumVertices() != V) throw std::invalid_argument("IncrementalMST: graph has a different vertex count");
+        for (const Graph::EdgeBatch::Update& op : batch.getUpdates()) {
+            if (op.insert) {
+                insert(op.u, op.v, op.w);
+            } else if (nodeOf.count(pairKey(op.u, op.v))) {
+                rebuild(after); // Also covers the rest of the batch, already in after
+                return;
+            }
+        }
+    }
+
+    long long getTotalWeight() const { return totalWeight; }
+
+    int getNumComponents() const { return components; } // Trees, isolated vertices included
+
+    std::size_t getNumTreeEdges() const { return nodeOf.size(); }
+
+    // Tree edges by weight
+    std::vector<MST::Edge> edges() const
+    {
+        std::vector<MST::Edge> result;
+        result.reserve(nodeOf.size());
+        for (const auto& entry : nodeOf) {
+            const TreeEdge& e = edgeAt[entry.second - V - 1];
+            result.push_back({e.u, e.v, e.weight});
+        }
+        std::sort(result.begin(), result.end(), [](const MST::Edge& a, const MST::Edge& b) {
+            return a.weight != b.weight ? a.weight < b.weight : std::make_pair(a.u, a.v) < std::make_pair(b.u, b.v);
+        });
+        return result;
+    }
+};
+
+#endif
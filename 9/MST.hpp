@@ -5,16 +5,43 @@
 #include "Graph.hpp"
 #include <vector>
 #include <algorithm>
+#include <limits>
+#include <numeric>
+#include <atomic>
+#include <thread>
+#include <cstddef>
+#include <cstdint>
 #include <sstream>
+#include <string>
 
 class MST : public Algorithms {
-private:
+public:
+    // Auto picks Prim for dense graphs (average degree >= kPrimMinDegree), Boruvka for large
+    // sparse ones when at least kParallelMinThreads threads are available, else Kruskal
+    enum class Method { Auto, Kruskal, Prim, Boruvka };
+
+    // Average degree from which Auto runs Prim instead of Kruskal
+    static constexpr std::size_t kPrimMinDegree = 64;
+
+    // Adjacency entries (two per edge) from which Auto runs the parallel Boruvka
+    static constexpr std::size_t kParallelMinEntries = std::size_t(1) << 21;
+
+    // Boruvka scans the remaining edges once per round (about log V rounds), so it needs a few
+    // threads to beat Kruskal's single pass over counting-sorted edges
+    static constexpr int kParallelMinThreads = 4;
+
     struct Edge {
         int u, v, weight;
         bool operator<(const Edge& other) const {
             return weight < other.weight;
         }
     };
+
+    // Edges of a minimum spanning forest of an undirected graph, by weight (Kruskal)
+    template <typename G>
+    static std::vector<Edge> spanningForest(const G& g) { return kruskal(g); }
+
+private:
     
     // Union-Find data structure for Kruskal's algorithm
     class UnionFind {
@@ -49,14 +76,107 @@ private:
         }
     };
 
-public:
-    std::string run(Graph& g) override {
-        if (g.isDirected()) {
-            return "ERROR: MST algorithm works only on undirected graphs\n";
+    // Min-heap of vertices keyed by edge weight, with decrease-key (Prim's frontier).
+    // 4-ary: half the depth of a binary heap, and the children of a node are adjacent.
+    class IndexedHeap {
+        static constexpr std::size_t D = 4;
+        std::vector<int> heap; // Vertices in heap order
+        std::vector<int> pos;  // Slot of each vertex in heap, -1 if not in it
+        std::vector<int> key;  // Key of each vertex (kept after pop)
+
+        void place(std::size_t i, int v) {
+            heap[i] = v;
+            pos[v] = static_cast<int>(i);
         }
-        
+
+        void siftUp(std::size_t i) {
+            const int v = heap[i];
+            while (i > 0) {
+                std::size_t parent = (i - 1) / D;
+                if (key[heap[parent]] <= key[v]) break;
+                place(i, heap[parent]);
+                i = parent;
+            }
+            place(i, v);
+        }
+
+        void siftDown(std::size_t i) {
+            const int v = heap[i];
+            const std::size_t n = heap.size();
+            for (;;) {
+                std::size_t first = D * i + 1;
+                if (first >= n) break;
+                std::size_t best = first;
+                for (std::size_t c = first + 1; c < std::min(first + D, n); ++c) {
+                    if (key[heap[c]] < key[heap[best]]) best = c;
+                }
+                if (key[heap[best]] >= key[v]) break;
+                place(i, heap[best]);
+                i = best;
+            }
+            place(i, v);
+        }
+
+    public:
+        explicit IndexedHeap(int n) : pos(n, -1), key(n, 0) {}
+
+        bool empty() const { return heap.empty(); }
+
+        bool contains(int v) const { return pos[v] >= 0; }
+
+        int keyOf(int v) const { return key[v]; }
+
+        // Insert v with key k, or lower its key to k (caller checks k < keyOf(v))
+        void push(int v, int k) {
+            key[v] = k;
+            if (pos[v] < 0) {
+                heap.push_back(v);
+                pos[v] = static_cast<int>(heap.size() - 1);
+            }
+            siftUp(static_cast<std::size_t>(pos[v]));
+        }
+
+        int pop() {
+            const int top = heap[0];
+            pos[top] = -1;
+            const int last = heap.back();
+            heap.pop_back();
+            if (!heap.empty()) {
+                place(0, last);
+                siftDown(0);
+            }
+            return top;
+        }
+    };
+
+    // Widest weight range (max - min + 1) sorted by counting; its counters take 8 bytes each
+    static constexpr std::size_t kMaxCountingRange = std::size_t(1) << 20;
+
+    // Stable: equal weights keep collection order whichever sort runs, so the chosen
+    // tree does not depend on the weight range. Counting sort in O(E + range) when the
+    // range is at most E (e.g. the generators' 1..10 or 16-bit weights), else std::stable_sort.
+    static void sortByWeight(std::vector<Edge>& edges, int minWeight, int maxWeight) {
+        const std::size_t range = static_cast<std::size_t>(static_cast<long long>(maxWeight) - minWeight) + 1;
+        if (range > edges.size() || range > kMaxCountingRange) {
+            std::stable_sort(edges.begin(), edges.end());
+            return;
+        }
+
+        std::vector<std::size_t> start(range + 1, 0); // Start of each weight's bucket
+        for (const Edge& e : edges) ++start[e.weight - minWeight + 1];
+        for (std::size_t w = 0; w < range; ++w) start[w + 1] += start[w];
+
+        std::vector<Edge> sorted(edges.size());
+        for (const Edge& e : edges) sorted[start[e.weight - minWeight]++] = e;
+        edges.swap(sorted);
+    }
+
+    // Kruskal: sorts every edge, then grows a forest with union-find. Returns the tree edges by weight.
+    template <typename G>
+    static std::vector<Edge> kruskal(const G& g) {
         std::vector<Edge> edges;
         int V = g.getNumVertices();
+        int minWeight = std::numeric_limits<int>::max(), maxWeight = std::numeric_limits<int>::min();
         
         // Collect all edges
         for (int u = 0; u < V; u++) {
@@ -66,43 +186,365 @@ public:
                 // Add edge only once for undirected graph
                 if (u < v) {
                     edges.push_back({u, v, weight});
+                    minWeight = std::min(minWeight, weight);
+                    maxWeight = std::max(maxWeight, weight);
                 }
             }
         }
         
-        if (edges.empty()) {
-            return "MST: No edges in graph\n";
-        }
-        
         // Sort edges by weight
-        std::sort(edges.begin(), edges.end());
+        sortByWeight(edges, minWeight, maxWeight);
         
         UnionFind uf(V);
         std::vector<Edge> mst;
-        int totalWeight = 0;
         
         // Kruskal's algorithm
         for (const Edge& e : edges) {
             if (uf.unite(e.u, e.v)) {
                 mst.push_back(e);
-                totalWeight += e.weight;
-                if (mst.size() == V - 1) break;
+                if (mst.size() == static_cast<std::size_t>(V - 1)) break;
+            }
+        }
+        return mst;
+    }
+
+    // Prim with an indexed heap: O(E log V) time and O(V) memory, no edge list. Restarts from
+    // every vertex not yet reached, so a disconnected graph gives a spanning forest.
+    // Returns the tree edges in the order they joined the forest.
+    template <typename G>
+    static std::vector<Edge> prim(const G& g) {
+        const int V = g.getNumVertices();
+        std::vector<Edge> mst;
+        std::vector<int> parent(V, -1);
+        std::vector<char> inTree(V, 0);
+        IndexedHeap frontier(V);
+
+        for (int start = 0; start < V; start++) {
+            if (inTree[start]) continue;
+            frontier.push(start, 0);
+            while (!frontier.empty()) {
+                const int u = frontier.pop();
+                inTree[u] = 1;
+                if (parent[u] >= 0) mst.push_back({parent[u], u, frontier.keyOf(u)});
+
+                for (const auto& neighbor : g.getNeighbors(u)) {
+                    const int v = neighbor.first;
+                    if (inTree[v] || (frontier.contains(v) && neighbor.second >= frontier.keyOf(v))) continue;
+                    frontier.push(v, neighbor.second);
+                    parent[v] = u;
+                }
             }
         }
+        return mst;
+    }
+
+    // Edge for Boruvka: key = (weight with its sign bit flipped) << 32 | edge id, where the id
+    // is the edge's position in Kruskal's collection order. Keys are distinct, so the MST
+    // under this order is unique: the same tree as Kruskal's, for any thread count.
+    struct KeyedEdge {
+        int u, v;
+        std::uint64_t key;
+    };
+
+    static constexpr std::uint64_t kNoEdge = ~std::uint64_t(0);
+
+    static std::uint64_t weightKey(int weight) {
+        return static_cast<std::uint64_t>(static_cast<std::uint32_t>(weight) ^ 0x80000000u) << 32;
+    }
+
+    static int keyWeight(std::uint64_t key) {
+        return static_cast<int>(static_cast<std::uint32_t>(key >> 32) ^ 0x80000000u);
+    }
+
+    static void atomicMin(std::atomic<std::uint64_t>& slot, std::uint64_t key) {
+        std::uint64_t current = slot.load(std::memory_order_relaxed);
+        while (key < current && !slot.compare_exchange_weak(current, key, std::memory_order_relaxed)) {
+        }
+    }
+
+    // Run f(t) for t in [0, threads), one thread each (t = 0 on the caller)
+    template <typename F>
+    static void forEachThread(int threads, F f) {
+        std::vector<std::thread> pool;
+        for (int t = 1; t < threads; t++) {
+            pool.emplace_back(f, t);
+        }
+        f(0);
+        for (std::thread& th : pool) {
+            th.join();
+        }
+    }
+
+    // Run f(i) for every i in [0, n), split into one contiguous slice per thread
+    template <typename F>
+    static void forEachIndex(std::size_t n, int threads, F f) {
+        forEachThread(threads, [&](int t) {
+            std::size_t end = n * (t + 1) / threads;
+            for (std::size_t i = n * t / threads; i < end; i++) {
+                f(i);
+            }
+        });
+    }
+
+    // Parallel Boruvka: each round every component picks its lightest outgoing edge (atomic min
+    // on the key), the picks are added to the forest and merged, and the next round's scan drops
+    // edges inside a component. O(log V) rounds of O(E / threads + V) each. Returns the tree edges by weight.
+    template <typename G>
+    std::vector<Edge> boruvka(const G& g) const {
+        const int V = g.getNumVertices();
+        const int T = workerThreads();
+
+        // Contiguous vertex ranges with about the same number of entries, collected in order
+        std::vector<std::size_t> prefix(static_cast<std::size_t>(V) + 1, 0);
+        for (int u = 0; u < V; u++) {
+            prefix[u + 1] = prefix[u] + static_cast<std::size_t>(g.get_out_degree(u));
+        }
+        if (prefix[V] / 2 >= static_cast<std::size_t>(std::numeric_limits<std::uint32_t>::max())) {
+            return kruskal(g); // Edge ids would not fit in the key
+        }
+        std::vector<int> bounds(T + 1, V);
+        bounds[0] = 0;
+        for (int t = 1; t < T; t++) {
+            std::size_t target = prefix[V] * t / T;
+            bounds[t] = static_cast<int>(std::lower_bound(prefix.begin(), prefix.end(), target) - prefix.begin());
+            bounds[t] = std::min(std::max(bounds[t], bounds[t - 1]), V);
+        }
+
+        std::vector<std::vector<KeyedEdge>> parts(T); // Thread t's edges, in collection order
+        forEachThread(T, [&](int t) {
+            parts[t].reserve((prefix[bounds[t + 1]] - prefix[bounds[t]]) / 2);
+            for (int u = bounds[t]; u < bounds[t + 1]; u++) {
+                for (const auto& neighbor : g.getNeighbors(u)) {
+                    if (u < neighbor.first) {
+                        parts[t].push_back({u, neighbor.first, weightKey(neighbor.second)});
+                    }
+                }
+            }
+        });
+        std::vector<std::uint64_t> firstId(T, 0);
+        for (int t = 1; t < T; t++) {
+            firstId[t] = firstId[t - 1] + parts[t - 1].size();
+        }
+        forEachThread(T, [&](int t) {
+            for (std::size_t i = 0; i < parts[t].size(); i++) {
+                parts[t][i].key |= firstId[t] + i;
+            }
+        });
+
+        std::vector<int> comp(V); // Component (its root vertex) of every vertex
+        std::iota(comp.begin(), comp.end(), 0);
+        std::vector<int> roots(comp); // Components that may still have outgoing edges
+        std::vector<std::atomic<std::uint64_t>> best(V);
+        std::vector<KeyedEdge> picked(V); // Lightest outgoing edge of each root
+        std::vector<int> hook(V);
+        std::vector<KeyedEdge> tree;
+
+        while (!roots.empty()) {
+            for (int c : roots) {
+                best[c].store(kNoEdge, std::memory_order_relaxed);
+            }
+            forEachThread(T, [&](int t) { // Also drops edges that now lie inside a component
+                std::vector<KeyedEdge>& part = parts[t];
+                std::size_t kept = 0;
+                for (const KeyedEdge& e : part) {
+                    const int cu = comp[e.u], cv = comp[e.v];
+                    if (cu == cv) continue;
+                    atomicMin(best[cu], e.key);
+                    atomicMin(best[cv], e.key);
+                    part[kept++] = e;
+                }
+                part.resize(kept);
+            });
+            forEachThread(T, [&](int t) { // Keys are unique: one writer per root
+                for (const KeyedEdge& e : parts[t]) {
+                    if (best[comp[e.u]].load(std::memory_order_relaxed) == e.key) picked[comp[e.u]] = e;
+                    if (best[comp[e.v]].load(std::memory_order_relaxed) == e.key) picked[comp[e.v]] = e;
+                }
+            });
+
+            // Hook every root along its pick; of two roots picking each other, the smaller stays root
+            std::vector<int> merging;
+            for (int c : roots) {
+                if (best[c].load(std::memory_order_relaxed) == kNoEdge) continue; // A finished component
+                const KeyedEdge& e = picked[c];
+                int other = comp[e.u] == c ? comp[e.v] : comp[e.u];
+                bool mutual = best[other].load(std::memory_order_relaxed) == e.key;
+                if (mutual && c < other) {
+                    hook[c] = c;
+                } else {
+                    hook[c] = other;
+                    tree.push_back(e);
+                }
+                merging.push_back(c);
+            }
+            for (int c : merging) {
+                int r = c;
+                while (hook[r] != r) r = hook[r];
+                for (int x = c; hook[x] != r; ) { // Path compression
+                    int next = hook[x];
+                    hook[x] = r;
+                    x = next;
+                }
+            }
+            forEachIndex(comp.size(), T, [&](std::size_t v) {
+                if (best[comp[v]].load(std::memory_order_relaxed) != kNoEdge) comp[v] = hook[comp[v]];
+            });
+
+            roots.clear();
+            for (int c : merging) {
+                if (hook[c] == c) roots.push_back(c);
+            }
+        }
+
+        std::sort(tree.begin(), tree.end(), [](const KeyedEdge& a, const KeyedEdge& b) { return a.key < b.key; });
+        std::vector<Edge> mst;
+        mst.reserve(tree.size());
+        for (const KeyedEdge& e : tree) {
+            mst.push_back({e.u, e.v, keyWeight(e.key)});
+        }
+        return mst;
+    }
+
+    template <typename G>
+    std::string solve(const G& g) {
+        if (g.isDirected()) {
+            return "ERROR: MST algorithm works only on undirected graphs\n";
+        }
+
+        int V = g.getNumVertices();
+        std::size_t entries = 0; // Adjacency entries, two per edge
+        for (int u = 0; u < V; u++) {
+            entries += static_cast<std::size_t>(g.get_out_degree(u));
+        }
+        
+        if (entries == 0) {
+            return report(g, {});
+        }
+
+        Method use = method;
+        if (use == Method::Auto) {
+            const bool parallel = workerThreads() >= kParallelMinThreads;
+            use = entries >= static_cast<std::size_t>(V) * kPrimMinDegree ? Method::Prim
+                : parallel && entries >= kParallelMinEntries ? Method::Boruvka
+                : Method::Kruskal;
+        }
+        std::vector<Edge> mst;
+        if (use == Method::Prim) {
+            mst = prim(g);
+            std::stable_sort(mst.begin(), mst.end()); // Listed by weight, like Kruskal's output
+        } else if (use == Method::Boruvka) {
+            mst = boruvka(g);
+        } else {
+            mst = kruskal(g);
+        }
+        return report(g, mst); // Every method above returns a spanning forest
+    }
+
+    template <typename G>
+    static void printEdge(const G& g, const Edge& e, std::ostringstream& result) {
+        int a = g.originalId(e.u), b = g.originalId(e.v); // Ids before any relabel
+        result << std::min(a, b) << " - " << std::max(a, b) << " (weight: " << e.weight << ")\n";
+    }
+
+    // The forest's trees one by one, ordered by their smallest vertex id, each with its edges in
+    // the forest's order (by weight) and its weight. Isolated vertices are only counted.
+    template <typename G>
+    static void printForest(const G& g, const std::vector<Edge>& forest, std::ostringstream& result) {
+        const int V = g.getNumVertices();
+        UnionFind uf(V);
+        for (const Edge& e : forest) {
+            uf.unite(e.u, e.v);
+        }
+
+        struct Tree {
+            int minId = std::numeric_limits<int>::max(); // Smallest original vertex id
+            int vertices = 0;
+            long long weight = 0;
+            std::vector<int> edges; // Indices into forest
+        };
+        std::vector<int> treeOf(V, -1); // Tree index of each union-find root
+        std::vector<Tree> trees;
+        for (int v = 0; v < V; v++) {
+            int root = uf.find(v);
+            if (treeOf[root] < 0) {
+                treeOf[root] = static_cast<int>(trees.size());
+                trees.emplace_back();
+            }
+            Tree& tree = trees[treeOf[root]];
+            tree.minId = std::min(tree.minId, g.originalId(v));
+            tree.vertices++;
+        }
+        long long totalWeight = 0;
+        for (std::size_t i = 0; i < forest.size(); i++) {
+            Tree& tree = trees[treeOf[uf.find(forest[i].u)]];
+            tree.weight += forest[i].weight;
+            tree.edges.push_back(static_cast<int>(i));
+            totalWeight += forest[i].weight;
+        }
+        std::sort(trees.begin(), trees.end(), [](const Tree& a, const Tree& b) { return a.minId < b.minId; });
+
+        const std::size_t isolated = trees.size() - static_cast<std::size_t>(
+            std::count_if(trees.begin(), trees.end(), [](const Tree& t) { return !t.edges.empty(); }));
+        result << "Minimum spanning forest: " << trees.size() << " components (isolated vertices: " << isolated << ")\n";
+        int number = 0;
+        for (const Tree& tree : trees) {
+            if (tree.edges.empty()) continue;
+            result << "Component " << ++number << " (" << tree.vertices << " vertices, weight " << tree.weight << "):\n";
+            for (int i : tree.edges) {
+                printEdge(g, forest[i], result);
+            }
+        }
+        result << "Total forest weight: " << totalWeight << "\n";
+    }
+
+    Method method;
+    int threads; // Boruvka's worker threads, 0 = all cores
+
+    int workerThreads() const {
+        return threads > 0 ? threads : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+
+public:
+    explicit MST(Method method = Method::Auto, int threads = 0) : method(method), threads(threads) {}
+
+    // "MST", "MST:KRUSKAL", "MST:PRIM" or "MST:BORUVKA"; false for any other name
+    static bool parseMethod(const std::string& algorithmName, Method& method) {
+        if (algorithmName == "MST") method = Method::Auto;
+        else if (algorithmName == "MST:KRUSKAL") method = Method::Kruskal;
+        else if (algorithmName == "MST:PRIM") method = Method::Prim;
+        else if (algorithmName == "MST:BORUVKA") method = Method::Boruvka;
+        else return false;
+        return true;
+    }
+
+    // What run prints for a minimum spanning forest of g (edges by weight), e.g. one kept by IncrementalMST
+    template <typename G>
+    static std::string report(const G& g, const std::vector<Edge>& forest) {
+        if (forest.empty()) {
+            return "MST: No edges in graph\n";
+        }
+
+        long long totalWeight = 0; // V - 1 weights of up to 2^31 each
+        for (const Edge& e : forest) {
+            totalWeight += e.weight;
+        }
         
         std::ostringstream result;
-        if (mst.size() < V - 1) {
+        if (forest.size() < static_cast<std::size_t>(g.getNumVertices() - 1)) {
             result << "MST: Graph is not connected\n";
+            printForest(g, forest, result);
         } else {
             result << "MST edges:\n";
-            for (const Edge& e : mst) {
-                result << e.u << " - " << e.v << " (weight: " << e.weight << ")\n";
+            for (const Edge& e : forest) {
+                printEdge(g, e, result);
             }
             result << "Total MST weight: " << totalWeight << "\n";
         }
         
         return result.str();
     }
+
+    std::string run(GraphView g) override { return std::visit([this](auto graph) { return solve(*graph); }, g); }
 };
 
 #endif
\ No newline at end of file
@@ -3,16 +3,22 @@
 
 #include "Algorithms.hpp"
 #include "Graph.hpp"
+#include "BitsetGraph.hpp"
 #include <vector>
 #include <sstream>
 #include <algorithm>
+#include <iterator>
+#include <cstdint>
 
 class MaxClique : public Algorithms {
 private:
     std::vector<int> maxClique;
     
-    void bronKerbosch(std::vector<int>& R, std::vector<int>& P, std::vector<int>& X, const Graph& g) {
-        if (P.empty() && X.empty()) {
+    // P is a bitset, so P ∩ N(v) and |P ∩ N(v)| are word operations. X keeps its
+    // insertion order, which (with P's ascending order) decides ties between pivots.
+    void bronKerbosch(std::vector<int>& R, std::vector<std::uint64_t>& P, std::vector<int>& X, const BitsetGraph& adj) {
+        const std::size_t words = adj.wordsPerRow();
+        if (!BitsetGraph::any(P.data(), words) && X.empty()) {
             // Found a maximal clique
             if (R.size() > maxClique.size()) {
                 maxClique = R;
@@ -22,41 +28,95 @@ private:
         
         // Choose pivot vertex (heuristic: vertex with most connections to P)
         int pivot = -1;
-        int maxConnections = -1;
+        long long maxConnections = -1;
         
-        for (int v : P) {
-            int connections = 0;
-            for (int u : P) {
-                if (v != u && g.isEdgeConnected(v, u)) {
-                    connections++;
-                }
+        BitsetGraph::forEach(P.data(), words, [&](int v) {
+            long long connections = static_cast<long long>(BitsetGraph::andCount(P.data(), adj.row(v), words));
+            if (connections > maxConnections) {
+                maxConnections = connections;
+                pivot = v;
             }
+        });
+        
+        for (int v : X) {
+            long long connections = static_cast<long long>(BitsetGraph::andCount(P.data(), adj.row(v), words));
             if (connections > maxConnections) {
                 maxConnections = connections;
                 pivot = v;
             }
         }
         
-        for (int v : X) {
-            int connections = 0;
-            for (int u : P) {
-                if (g.isEdgeConnected(v, u)) {
-                    connections++;
+        // For each vertex in P \ N(pivot)
+        std::vector<int> candidates;
+        BitsetGraph::forEachAndNot(P.data(), adj.row(pivot), words, [&](int v) { candidates.push_back(v); });
+        
+        std::vector<std::uint64_t> P_new(words); // Reused by every candidate
+        for (int v : candidates) {
+            // R' = R ∪ {v}
+            std::vector<int> R_new = R;
+            R_new.push_back(v);
+            
+            // P' = P ∩ N(v)
+            BitsetGraph::andWords(P_new.data(), P.data(), adj.row(v), words);
+            
+            // X' = X ∩ N(v)
+            std::vector<int> X_new;
+            for (int u : X) {
+                if (adj.isEdgeConnected(v, u)) {
+                    X_new.push_back(u);
                 }
             }
+            
+            bronKerbosch(R_new, P_new, X_new, adj); // May clear bits of P_new; it is rebuilt above
+            
+            // Move v from P to X
+            BitsetGraph::reset(P.data(), v);
+            X.push_back(v);
+        }
+    }
+
+    // Same search with P as an ascending vertex list, for graphs too large for the bit matrix.
+    // inP marks P while the pivot is chosen, so scoring a vertex costs O(deg) instead of O(|P|).
+    void bronKerboschSparse(std::vector<int>& R, std::vector<int>& P, std::vector<int>& X, const SortedAdjacency& adj,
+                            std::vector<char>& inP) {
+        if (P.empty() && X.empty()) {
+            // Found a maximal clique
+            if (R.size() > maxClique.size()) {
+                maxClique = R;
+            }
+            return;
+        }
+        
+        // Choose pivot vertex (heuristic: vertex with most connections to P)
+        int pivot = -1;
+        long long maxConnections = -1;
+        
+        for (int v : P) inP[v] = 1;
+        auto connectionsToP = [&](int v) {
+            long long connections = 0;
+            for (const int* u = adj.begin(v); u != adj.end(v); ++u) connections += inP[*u];
+            return connections;
+        };
+        for (int v : P) {
+            long long connections = connectionsToP(v);
+            if (connections > maxConnections) {
+                maxConnections = connections;
+                pivot = v;
+            }
+        }
+        for (int v : X) {
+            long long connections = connectionsToP(v);
             if (connections > maxConnections) {
                 maxConnections = connections;
                 pivot = v;
             }
         }
+        for (int v : P) inP[v] = 0;
         
         // For each vertex in P \ N(pivot)
         std::vector<int> candidates;
         for (int v : P) {
-            bool connected_to_pivot = (pivot != -1) && g.isEdgeConnected(pivot, v);
-            if (!connected_to_pivot) {
-                candidates.push_back(v);
-            }
+            if (!adj.isEdgeConnected(pivot, v)) candidates.push_back(v);
         }
         
         for (int v : candidates) {
@@ -64,32 +124,28 @@ private:
             std::vector<int> R_new = R;
             R_new.push_back(v);
             
-            // P' = P ∩ N(v)
+            // P' = P ∩ N(v), still ascending
             std::vector<int> P_new;
-            for (int u : P) {
-                if (u != v && g.isEdgeConnected(v, u)) {
-                    P_new.push_back(u);
-                }
-            }
+            std::set_intersection(P.begin(), P.end(), adj.begin(v), adj.end(v), std::back_inserter(P_new));
             
             // X' = X ∩ N(v)
             std::vector<int> X_new;
             for (int u : X) {
-                if (g.isEdgeConnected(v, u)) {
+                if (adj.isEdgeConnected(v, u)) {
                     X_new.push_back(u);
                 }
             }
             
-            bronKerbosch(R_new, P_new, X_new, g);
+            bronKerboschSparse(R_new, P_new, X_new, adj, inP);
             
             // Move v from P to X
-            P.erase(std::find(P.begin(), P.end(), v));
+            P.erase(std::lower_bound(P.begin(), P.end(), v));
             X.push_back(v);
         }
     }
 
-public:
-    std::string run(Graph& g) override {
+    template <typename G>
+    std::string solve(const G& g) {
         if (g.isDirected()) {
             return "ERROR: Max Clique algorithm works only on undirected graphs\n";
         }
@@ -98,20 +154,33 @@ public:
         int V = g.getNumVertices();
         
         std::vector<int> R; // Current clique
-        std::vector<int> P; // Candidate vertices
         std::vector<int> X; // Excluded vertices
         
-        // Initialize P with all vertices
-        for (int i = 0; i < V; i++) {
-            P.push_back(i);
+        if (BitsetGraph::fits(V)) {
+            BitsetGraph adj(g); // Adjacency rows as bitsets, built once per run
+            std::vector<std::uint64_t> P(adj.wordsPerRow(), 0); // Candidate vertices
+            
+            // Initialize P with all vertices
+            for (int i = 0; i < V; i++) {
+                BitsetGraph::set(P.data(), i);
+            }
+            
+            bronKerbosch(R, P, X, adj);
+        } else {
+            // V^2 bits would not fit: sorted neighbor lists instead
+            SortedAdjacency adj(g);
+            std::vector<int> P(V); // Candidate vertices, ascending
+            for (int i = 0; i < V; i++) P[i] = i;
+            std::vector<char> inP(V, 0);
+            
+            bronKerboschSparse(R, P, X, adj, inP);
         }
         
-        bronKerbosch(R, P, X, g);
-        
         std::ostringstream result;
         if (maxClique.empty()) {
             result << "Maximum clique: empty (no vertices)\n";
         } else {
+            for (int& v : maxClique) v = g.originalId(v); // Report ids before any relabel
             std::sort(maxClique.begin(), maxClique.end());
             result << "Maximum clique size: " << maxClique.size() << "\n";
             result << "Maximum clique vertices: {";
@@ -124,6 +193,9 @@ public:
         
         return result.str();
     }
+
+public:
+    std::string run(GraphView g) override { return std::visit([this](auto graph) { return solve(*graph); }, g); }
 };
 
 #endif
\ No newline at end of file
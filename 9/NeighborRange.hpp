@@ -0,0 +1,50 @@
+#ifndef NEIGHBOR_RANGE_HPP
+#define NEIGHBOR_RANGE_HPP
+
+#include <utility> // For std::pair
+#include <iterator>
+#include <cstddef>
+
+/**
+ * @brief One adjacency row stored as two parallel arrays (ids and weights).
+ *
+ * Iterating yields {neighbor, weight} pairs like Graph::getNeighbors, whatever
+ * the stored widths VId and W. Used by CsrGraph, MappedGraph and Transpose.
+ */
+template <typename VId, typename W>
+class SoaNeighborIterator
+{
+    const VId* t;
+    const W* w;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<int, int>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::pair<int, int>;
+
+        SoaNeighborIterator(const VId* t, const W* w) : t(t), w(w) {}
+
+        std::pair<int, int> operator*() const { return {static_cast<int>(*t), static_cast<int>(*w)}; }
+        SoaNeighborIterator& operator++() { ++t; ++w; return *this; }
+        SoaNeighborIterator operator++(int) { SoaNeighborIterator old = *this; ++(*this); return old; }
+        bool operator==(const SoaNeighborIterator& other) const { return t == other.t; }
+        bool operator!=(const SoaNeighborIterator& other) const { return t != other.t; }
+};
+
+template <typename VId, typename W>
+class SoaNeighborRange
+{
+    const VId* t;
+    const W* w;
+    std::size_t n;
+    public:
+        SoaNeighborRange(const VId* t, const W* w, std::size_t n) : t(t), w(w), n(n) {}
+
+        SoaNeighborIterator<VId, W> begin() const { return {t, w}; }
+        SoaNeighborIterator<VId, W> end() const { return {t + n, w + n}; }
+        std::size_t size() const { return n; }
+        bool empty() const { return n == 0; }
+};
+
+#endif
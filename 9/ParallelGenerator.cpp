@@ -0,0 +1,149 @@
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <unordered_set>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Graph.hpp"
+#include "Philox.hpp"
+
+
+// Stream purposes; the second counter word is purpose + 4 * round
+static const std::uint32_t kPurposeSample = 0;
+static const std::uint32_t kPurposeWeight = 1;
+static const std::uint32_t kPurposeTrim = 2;
+static const std::uint32_t kTrimRow = 0xFFFFFFFFu; // Never a real row id
+
+// Run f(u) for every row, handing out fixed-size chunks dynamically.
+// Each row's output depends only on (seed, u), so the schedule never changes the result.
+template <typename F>
+static void forEachRow(int V, int threads, F f)
+{
+    const int chunk = 256;
+    std::atomic<int> nextRow{0};
+    auto worker = [&]() {
+        for (;;) {
+            int begin = nextRow.fetch_add(chunk);
+            if (begin >= V) return;
+            int end = std::min(V, begin + chunk);
+            for (int u = begin; u < end; ++u) f(u);
+        }
+    };
+
+    if (threads <= 1) {
+        worker();
+        return;
+    }
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) pool.emplace_back(worker);
+    for (std::thread& th : pool) th.join();
+}
+
+Graph Graph::generateRandomGraphParallel(int V, long long E, std::uint64_t seed, bool directed, int threads)
+{
+    if (V <= 0) throw std::invalid_argument("V must be positive");
+    const std::uint64_t n = static_cast<std::uint64_t>(V);
+    const std::uint64_t N = directed ? n * (n - 1) : n * (n - 1) / 2;
+    if (E < 0 || static_cast<std::uint64_t>(E) > N)
+        throw std::invalid_argument("E must be between 0 and the number of vertex pairs");
+
+    if (threads <= 0) threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    // Dense requests sample the (smaller) set of missing edges instead
+    const std::uint64_t m = static_cast<std::uint64_t>(E);
+    const bool complement = m > N / 2;
+    const std::uint64_t target = complement ? N - m : m;
+
+    auto rowLength = [&](int u) { return directed ? V - 1 : V - 1 - u; };
+
+    // Phase 1: every row independently keeps each slot with probability p >= target / N
+    // (geometric skipping on its own Philox stream), repeated until enough slots were kept.
+    std::vector<std::vector<int>> picked(V); // Kept offsets within each row, ascending
+    std::vector<std::uint64_t> rowStart(V + 1, 0);
+    std::uint32_t round = 0;
+    if (target > 0) {
+        const double p = std::min(1.0, (target + 3.0 * std::sqrt(static_cast<double>(target)) + 10.0) / static_cast<double>(N));
+        const double logQ = std::log1p(-p);
+        for (;; ++round) {
+            forEachRow(V, threads, [&](int u) {
+                std::vector<int>& row = picked[u];
+                row.clear();
+                const int L = rowLength(u);
+                if (p >= 1.0) {
+                    for (int j = 0; j < L; ++j) row.push_back(j);
+                    return;
+                }
+                PhiloxStream rng(seed, static_cast<std::uint32_t>(u), kPurposeSample + 4 * round);
+                long long j = 0;
+                while (j < L) {
+                    double skip = std::floor(std::log1p(-rng.uniform01()) / logQ);
+                    if (skip >= static_cast<double>(L - j)) break;
+                    j += static_cast<long long>(skip);
+                    row.push_back(static_cast<int>(j++));
+                }
+            });
+
+            for (int u = 0; u < V; ++u) rowStart[u + 1] = rowStart[u] + picked[u].size();
+            if (rowStart[V] >= target) break;
+        }
+    }
+
+    // Phase 2: drop the surplus at uniformly random global positions (Floyd), so exactly
+    // 'target' slots remain and every target-subset is equally likely. The surplus is
+    // O(sqrt(target)), so this sequential step is negligible.
+    const std::uint64_t kept = rowStart[V];
+    if (kept > target) {
+        PhiloxStream rng(seed, kTrimRow, kPurposeTrim + 4 * round);
+        std::unordered_set<std::uint64_t> drop;
+        for (std::uint64_t j = target; j < kept; ++j) {
+            std::uint64_t t = rng.below(j + 1);
+            drop.insert(drop.count(t) ? j : t);
+        }
+
+        std::vector<std::uint64_t> sorted(drop.begin(), drop.end());
+        std::sort(sorted.begin(), sorted.end());
+        std::size_t d = 0;
+        for (int u = 0; u < V && d < sorted.size(); ++u) {
+            if (sorted[d] >= rowStart[u + 1]) continue;
+            std::vector<int>& row = picked[u];
+            std::size_t out = 0;
+            for (std::size_t i = 0; i < row.size(); ++i) {
+                if (d < sorted.size() && sorted[d] == rowStart[u] + i) { ++d; continue; }
+                row[out++] = row[i];
+            }
+            row.resize(out);
+        }
+    }
+
+    // Phase 3: turn offsets into (neighbor, weight) rows, again in parallel and keyed by row
+    std::vector<std::vector<std::pair<int, int>>> rows(V);
+    forEachRow(V, threads, [&](int u) {
+        PhiloxStream rng(seed, static_cast<std::uint32_t>(u), kPurposeWeight);
+        const std::vector<int>& row = picked[u];
+        std::vector<std::pair<int, int>>& outRow = rows[u];
+        auto emit = [&](int j) {
+            int v = directed ? (j < u ? j : j + 1) : u + 1 + j;
+            outRow.push_back({v, static_cast<int>(rng.below(10)) + 1}); // Weight between 1 and 10
+        };
+
+        if (!complement) {
+            outRow.reserve(row.size());
+            for (int j : row) emit(j);
+        } else {
+            const int L = rowLength(u);
+            outRow.reserve(L - row.size());
+            std::size_t k = 0;
+            for (int j = 0; j < L; ++j) {
+                if (k < row.size() && row[k] == j) { ++k; continue; }
+                emit(j);
+            }
+        }
+        std::vector<int>().swap(picked[u]);
+    });
+
+    return fromRows(V, directed, rows);
+}
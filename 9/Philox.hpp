@@ -0,0 +1,82 @@
+#ifndef PHILOX_HPP
+#define PHILOX_HPP
+
+#include <cstdint>
+
+/**
+ * @brief Philox4x32-10 counter-based random generator (Salmon et al., SC'11).
+ *
+ * Output is a pure function of (key, counter), so any thread can jump straight
+ * to "the random numbers of row u" without replaying a sequential stream.
+ * That is what makes the parallel generator independent of the thread count.
+ */
+class PhiloxStream
+{
+    public:
+        // key: the user seed; a, b: stream coordinates (e.g. row id and purpose)
+        PhiloxStream(std::uint64_t seed, std::uint32_t a, std::uint32_t b)
+            : k0(static_cast<std::uint32_t>(seed)), k1(static_cast<std::uint32_t>(seed >> 32)), a(a), b(b) {}
+
+        std::uint32_t next32()
+        {
+            if (used == 4) refill();
+            return out[used++];
+        }
+
+        std::uint64_t next64()
+        {
+            std::uint64_t hi = next32();
+            return (hi << 32) | next32();
+        }
+
+        // Uniform double in [0, 1)
+        double uniform01()
+        {
+            return (next64() >> 11) * (1.0 / 9007199254740992.0);
+        }
+
+        // Uniform integer in [0, n)
+        std::uint64_t below(std::uint64_t n)
+        {
+            return static_cast<std::uint64_t>((static_cast<unsigned __int128>(next64()) * n) >> 64);
+        }
+
+    private:
+        std::uint32_t k0, k1;   // Key
+        std::uint32_t a, b;     // Fixed counter words
+        std::uint64_t block = 0; // Running counter words
+        std::uint32_t out[4] = {0, 0, 0, 0};
+        int used = 4;
+
+        static void mulhilo(std::uint32_t m, std::uint32_t x, std::uint32_t& hi, std::uint32_t& lo)
+        {
+            std::uint64_t p = static_cast<std::uint64_t>(m) * x;
+            hi = static_cast<std::uint32_t>(p >> 32);
+            lo = static_cast<std::uint32_t>(p);
+        }
+
+        void refill()
+        {
+            std::uint32_t c0 = static_cast<std::uint32_t>(block), c1 = static_cast<std::uint32_t>(block >> 32);
+            std::uint32_t c2 = a, c3 = b;
+            std::uint32_t key0 = k0, key1 = k1;
+
+            for (int round = 0; round < 10; ++round) {
+                std::uint32_t hi0, lo0, hi1, lo1;
+                mulhilo(0xD2511F53u, c0, hi0, lo0);
+                mulhilo(0xCD9E8D57u, c2, hi1, lo1);
+                std::uint32_t n0 = hi1 ^ c1 ^ key0;
+                std::uint32_t n1 = lo1;
+                std::uint32_t n2 = hi0 ^ c3 ^ key1;
+                std::uint32_t n3 = lo0;
+                c0 = n0; c1 = n1; c2 = n2; c3 = n3;
+                key0 += 0x9E3779B9u; // Weyl key schedule
+                key1 += 0xBB67AE85u;
+            }
+
+            out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+            used = 0;
+            ++block;
+        }
+};
+#endif
@@ -3,6 +3,7 @@
 
 #include "Algorithms.hpp"
 #include "Graph.hpp"
+#include "Traversal.hpp"
 #include <vector>
 #include <stack>
 #include <sstream>
@@ -10,33 +11,36 @@
 
 class SCC : public Algorithms {
 private:
-    void dfsFirst(int v, std::vector<bool>& visited, std::stack<int>& Stack, const Graph& g) {
-        visited[v] = true;
-        
-        for (const auto& neighbor : g.getNeighbors(v)) {
-            int u = neighbor.first;
-            if (!visited[u]) {
-                dfsFirst(u, visited, Stack, g);
-            }
-        }
-        
-        Stack.push(v);
+    template <typename G>
+    void dfsFirst(int v, std::vector<bool>& visited, std::stack<int>& Stack, const G& g, TraversalScratch<G>& scratch) {
+        // Iterative DFS; vertices are pushed in finishing order
+        iterativeDFS(g, v, visited, scratch, NoVisit(), [&Stack](int done) { Stack.push(done); });
     }
     
-    void dfsSecond(int v, std::vector<bool>& visited, std::vector<int>& component, const Graph& g) {
+    template <typename G>
+    void dfsSecond(int v, std::vector<bool>& visited, std::vector<int>& component, const G& g, std::vector<int>& work) {
         visited[v] = true;
         component.push_back(v);
+        work.clear();
+        work.push_back(v);
         
-        // For transpose graph, we need to find all vertices that have edge TO v
-        for (int u = 0; u < g.getNumVertices(); u++) {
-            if (!visited[u] && g.isEdgeConnected(u, v)) {
-                dfsSecond(u, visited, component, g);
+        // DFS on the transpose graph: follow the in-edges of x (cached by g), O(V + E) overall
+        while (!work.empty()) {
+            int x = work.back();
+            work.pop_back();
+            for (const auto& in : g.getInNeighbors(x)) {
+                int u = in.first;
+                if (!visited[u]) {
+                    visited[u] = true;
+                    component.push_back(u);
+                    work.push_back(u);
+                }
             }
         }
     }
 
-public:
-    std::string run(Graph& g) override {
+    template <typename G>
+    std::string solve(const G& g) {
         if (!g.isDirected()) {
             return "ERROR: SCC algorithm works only on directed graphs\n";
         }
@@ -44,17 +48,19 @@ public:
         int V = g.getNumVertices();
         std::stack<int> Stack;
         std::vector<bool> visited(V, false);
+        TraversalScratch<G> scratch; // Reused by every DFS tree
         
         // Step 1: Fill vertices in stack according to their finishing times
         for (int i = 0; i < V; i++) {
             if (!visited[i]) {
-                dfsFirst(i, visited, Stack, g);
+                dfsFirst(i, visited, Stack, g, scratch);
             }
         }
         
         // Step 2: Process vertices in order defined by Stack
         std::fill(visited.begin(), visited.end(), false);
         std::vector<std::vector<int>> sccs;
+        std::vector<int> work;
         
         while (!Stack.empty()) {
             int v = Stack.top();
@@ -62,7 +68,8 @@ public:
             
             if (!visited[v]) {
                 std::vector<int> component;
-                dfsSecond(v, visited, component, g);
+                dfsSecond(v, visited, component, g, work);
+                for (int& u : component) u = g.originalId(u); // Report ids before any relabel
                 std::sort(component.begin(), component.end());
                 sccs.push_back(component);
             }
@@ -82,6 +89,9 @@ public:
         
         return result.str();
     }
+
+public:
+    std::string run(GraphView g) override { return std::visit([this](auto graph) { return solve(*graph); }, g); }
 };
 
 #endif
\ No newline at end of file
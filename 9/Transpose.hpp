@@ -0,0 +1,111 @@
+#ifndef TRANSPOSE_HPP
+#define TRANSPOSE_HPP
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <stdexcept>
+
+#include "NeighborRange.hpp"
+
+/**
+ * @brief Reverse adjacency (in-edges) of a graph, in CSR form.
+ *
+ * Row v lists {u, w} for every stored entry u -> v with weight w, sources
+ * ascending. Built in O(V + E) from any graph type with a counting pass, so
+ * backward searches (SCC's second pass, predecessor scans) cost O(deg_in(v))
+ * per vertex instead of a V-wide isEdgeConnected loop.
+ */
+template <typename VId, typename W>
+class Transpose
+{
+    std::vector<std::size_t> offsets; // V + 1 row offsets into sources/weights
+    std::vector<VId> sources;         // Predecessor ids, row after row
+    std::vector<W> weights;           // Edge weights, parallel to sources
+
+    public:
+        // Throws std::out_of_range if the graph stores a neighbor id outside [0, V)
+        template <typename G>
+        explicit Transpose(const G& g) : offsets(static_cast<std::size_t>(g.getNumVertices()) + 1, 0)
+        {
+            const int V = g.getNumVertices();
+
+            // First pass: in-degrees -> prefix sums
+            for (int u = 0; u < V; ++u) {
+                for (const auto& neighbor : g.getNeighbors(u)) {
+                    if (neighbor.first < 0 || neighbor.first >= V)
+                        throw std::out_of_range("Transpose: neighbor id out of range");
+                    ++offsets[neighbor.first + 1];
+                }
+            }
+            for (int v = 0; v < V; ++v) offsets[v + 1] += offsets[v];
+
+            sources.resize(offsets[V]);
+            weights.resize(offsets[V]);
+
+            // Second pass: scatter u -> v into row v; sources arrive in ascending order
+            std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+            for (int u = 0; u < V; ++u) {
+                for (const auto& neighbor : g.getNeighbors(u)) {
+                    std::size_t pos = next[neighbor.first]++;
+                    sources[pos] = static_cast<VId>(u);
+                    weights[pos] = static_cast<W>(neighbor.second);
+                }
+            }
+        }
+
+        // Caller guarantees 0 <= v < V
+        SoaNeighborRange<VId, W> in(int v) const
+        {
+            return SoaNeighborRange<VId, W>(sources.data() + offsets[v], weights.data() + offsets[v],
+                                            offsets[v + 1] - offsets[v]);
+        }
+
+        int inDegree(int v) const { return static_cast<int>(offsets[v + 1] - offsets[v]); }
+};
+
+/**
+ * @brief Lazily built, shared transpose T for a graph that owns it.
+ *
+ * get() builds T(owner) on first use and keeps it until invalidate()
+ * (called by every mutation of the owner). Concurrent readers are safe: the
+ * first finished build is published atomically and a losing build is dropped,
+ * so a returned reference stays valid until the owner is next modified. Copies
+ * of the owner share the same immutable transpose, and copying is safe while
+ * other threads call get() on the source.
+ */
+template <typename T>
+class BasicTransposeCache
+{
+    mutable std::shared_ptr<const T> cached;
+
+    public:
+        BasicTransposeCache() = default;
+
+        BasicTransposeCache(const BasicTransposeCache& other) : cached(std::atomic_load(&other.cached)) {}
+
+        BasicTransposeCache& operator=(const BasicTransposeCache& other)
+        {
+            std::atomic_store(&cached, std::atomic_load(&other.cached));
+            return *this;
+        }
+
+        template <typename G>
+        const T& get(const G& g) const
+        {
+            std::shared_ptr<const T> current = std::atomic_load(&cached);
+            if (current) return *current;
+
+            std::shared_ptr<const T> built = std::make_shared<const T>(g);
+            if (std::atomic_compare_exchange_strong(&cached, &current, built))
+                return *built;
+            return *current; // Another thread published first
+        }
+
+        void invalidate() { std::atomic_store(&cached, std::shared_ptr<const T>()); }
+};
+
+template <typename VId, typename W>
+using TransposeCache = BasicTransposeCache<Transpose<VId, W>>;
+
+#endif
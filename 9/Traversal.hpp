@@ -0,0 +1,110 @@
+#ifndef TRAVERSAL_HPP
+#define TRAVERSAL_HPP
+
+#include <vector>
+#include <utility> // For std::declval
+#include <cstddef>
+
+/**
+ * @brief Iterative DFS/BFS over anything that exposes getNeighbors(v) ranges.
+ *
+ * No recursion (safe on long paths) and no I/O. The caller owns the visited
+ * bitmap and the scratch buffers, so repeated traversals over the same graph
+ * reuse their memory. Visitors are template parameters and inline away.
+ */
+
+// Visitor that does nothing, for callers that only need the visited bitmap
+struct NoVisit
+{
+    void operator()(int) const {}
+};
+
+template <typename G>
+struct TraversalScratch
+{
+    using NeighborIter = decltype(std::declval<const G&>().getNeighbors(0).begin());
+
+    struct Frame
+    {
+        int v;
+        NeighborIter it;
+        NeighborIter end;
+    };
+
+    std::vector<Frame> frames; // DFS stack: vertex plus its position in the neighbor list
+    std::vector<int> queue;    // BFS queue
+};
+
+/**
+ * @brief Depth-first search from start over vertices not yet marked in visited.
+ * @param onDiscover Called with each vertex when it is first reached (pre-order).
+ * @param onFinish Called with each vertex once all its neighbors are done (post-order).
+ *
+ * Neighbors are explored in getNeighbors order, so discovery and finish
+ * orders match the classic recursive formulation exactly.
+ */
+template <typename G, typename Discover = NoVisit, typename Finish = NoVisit>
+void iterativeDFS(const G& g, int start, std::vector<bool>& visited, TraversalScratch<G>& scratch,
+                  Discover onDiscover = Discover(), Finish onFinish = Finish())
+{
+    if (visited[start]) return;
+
+    auto& frames = scratch.frames;
+    frames.clear();
+
+    visited[start] = true;
+    onDiscover(start);
+    {
+        auto&& nbrs = g.getNeighbors(start);
+        frames.push_back({start, nbrs.begin(), nbrs.end()});
+    }
+
+    while (!frames.empty()) {
+        auto& top = frames.back();
+        if (top.it == top.end) {
+            int done = top.v;
+            frames.pop_back();
+            onFinish(done);
+            continue;
+        }
+
+        int next = (*top.it).first;
+        ++top.it;
+        if (!visited[next]) {
+            visited[next] = true;
+            onDiscover(next);
+            auto&& nbrs = g.getNeighbors(next);
+            frames.push_back({next, nbrs.begin(), nbrs.end()}); // May invalidate 'top'
+        }
+    }
+}
+
+/**
+ * @brief Breadth-first search from start over vertices not yet marked in visited.
+ * @param onDiscover Called with each vertex in BFS order.
+ */
+template <typename G, typename Discover = NoVisit>
+void iterativeBFS(const G& g, int start, std::vector<bool>& visited, TraversalScratch<G>& scratch,
+                  Discover onDiscover = Discover())
+{
+    if (visited[start]) return;
+
+    auto& queue = scratch.queue;
+    queue.clear();
+
+    visited[start] = true;
+    queue.push_back(start);
+
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        int v = queue[head];
+        onDiscover(v);
+        for (const auto& neighbor : g.getNeighbors(v)) {
+            if (!visited[neighbor.first]) {
+                visited[neighbor.first] = true;
+                queue.push_back(neighbor.first);
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef VERSIONED_GRAPH_HPP
+#define VERSIONED_GRAPH_HPP
+
+#include <memory>
+#include <mutex>
+#include <cstdint>
+
+#include "Graph.hpp"
+
+/**
+ * @brief A long-lived Graph updated by writers while readers keep working.
+ *
+ * snapshot() returns the latest published version. A snapshot never changes:
+ * apply() runs the batch on a copy-on-write copy of the current graph and then
+ * publishes the result in one atomic swap, so readers see either all of a batch
+ * or none of it. Writers are serialized. Each batch deep-copies the graph once
+ * (the previous version may still be in use), so group small updates into one
+ * batch rather than applying them one by one.
+ */
+class VersionedGraph
+{
+    std::shared_ptr<const Graph> current; // Only replaced through atomic_store, under writer
+    std::mutex writer;
+
+    public:
+        explicit VersionedGraph(Graph g) : current(std::make_shared<const Graph>(std::move(g))) {}
+
+        VersionedGraph(const VersionedGraph&) = delete;
+        VersionedGraph& operator=(const VersionedGraph&) = delete;
+
+        // Safe from any thread; valid for as long as the caller holds it
+        std::shared_ptr<const Graph> snapshot() const { return std::atomic_load(&current); }
+
+        std::uint64_t getVersion() const { return snapshot()->getVersion(); }
+
+        // Throws like Graph::applyBatch, in which case nothing is published.
+        // Returns the version of the published graph.
+        std::uint64_t apply(const Graph::EdgeBatch& batch)
+        {
+            return apply(batch, [](const Graph&) {});
+        }
+
+        // Same, but first calls beforePublish with the updated graph, to bring state derived
+        // from it up to date; if that throws, nothing is published either.
+        template <typename Hook>
+        std::uint64_t apply(const Graph::EdgeBatch& batch, Hook&& beforePublish)
+        {
+            std::lock_guard<std::mutex> lock(writer);
+            auto next = std::make_shared<Graph>(*current);
+            next->applyBatch(batch);
+            beforePublish(static_cast<const Graph&>(*next));
+            const std::uint64_t version = next->getVersion();
+            std::atomic_store(&current, std::shared_ptr<const Graph>(std::move(next)));
+            return version;
+        }
+};
+
+#endif
@@ -13,6 +13,7 @@
 #include <sys/time.h>
 #include <errno.h>
 #include <fstream>
+#include <climits>
 
 static const char* SOCKET_PATH = "mysocket";
 static const size_t MAXDATASIZE = 1024;
@@ -37,7 +38,9 @@ void print_usage(const char* prog_name) {
               << "  -a <algorithm>  Algorithm to run:\n"
               << "                  EULERIAN    - Find Eulerian circuit\n"
               << "                  SCC         - Strongly Connected Components\n"
-              << "                  MST         - Minimum Spanning Tree\n"
+              << "                  MST         - Minimum Spanning Tree (Prim if dense, parallel Boruvka if\n"
+              << "                                large on 4+ cores, else Kruskal)\n"
+              << "                  MST:PRIM, MST:KRUSKAL, MST:BORUVKA - MST with a fixed method\n"
               << "                  MAXCLIQUE   - Maximum Clique\n"
               << "                  HAMILTON    - Hamilton Circuit\n"
               << "  -v <vertices>   Number of vertices (for random graph)\n"
@@ -45,6 +48,18 @@ void print_usage(const char* prog_name) {
               << "  -s <seed>       Random seed\n"
               << "  -m <file>       Read adjacency matrix from file\n"
               << "  -i              Read adjacency matrix from stdin\n"
+              << "  -f <file>       Run on a binary graph file (see graphconv)\n"
+              << "  -n <name>       Run on a graph the server keeps under this name (created by the\n"
+              << "                  first request, which must give -v; starts with no edges). -a MST\n"
+              << "                  reports the spanning forest the server keeps updated as edits arrive\n"
+              << "  -I <u,v,w>      With -n: insert edge u - v with weight w (repeatable)\n"
+              << "  -R <u,v>        With -n: remove edge u - v (repeatable). A request's -I/-R edits\n"
+              << "                  are applied together, or not at all if any of them is invalid\n"
+              << "  -g <generator>  Random graph generator: legacy (default), gnm (exactly E edges),\n"
+              << "                  gnp (each edge with probability E / pairs), parallel (gnm on all cores)\n"
+              << "  -o <order>      Renumber the random graph for locality before running:\n"
+              << "                  none, rcm, degree, degeneracy, bfs (results keep the original ids)\n"
+              << "  -z <encoding>   Hold the random graph as compressed rows: varint or group\n"
               << "  -h              Show this help\n"
               << "\nExamples:\n"
               << "  " << prog_name << " -a EULERIAN -v 5 -e 6 -s 42\n"
@@ -53,7 +68,13 @@ void print_usage(const char* prog_name) {
               << "  " << prog_name << " -a MAXCLIQUE -v 5 -e 7 -s 789\n"
               << "  " << prog_name << " -a HAMILTON -v 4 -e 6 -s 101\n"
               << "  echo '0 1 1\\n1 0 1\\n1 1 0' | " << prog_name << " -a EULERIAN -i\n"
-              << "  " << prog_name << " -a MST -m matrix.txt\n";
+              << "  " << prog_name << " -a MST -m matrix.txt\n"
+              << "  " << prog_name << " -a SCC -f big.graph\n"
+              << "  " << prog_name << " -a MST -v 1000 -e 3000 -s 7 -o rcm\n"
+              << "  " << prog_name << " -a MST:PRIM -v 300 -e 40000 -s 7\n"
+              << "  " << prog_name << " -a SCC -v 100000 -e 500000 -s 7 -g parallel\n"
+              << "  " << prog_name << " -a MST -n roads -v 4 -I 0,1,5 -I 1,2,3 -I 2,3,4\n"
+              << "  " << prog_name << " -a MST -n roads -I 0,3,1 -R 1,2\n";
 }
 
 
@@ -138,11 +159,17 @@ int main(int argc, char* argv[]) {
     std::string algorithm;
     int V = 0, E = 0, seed = 0;
     std::string matrix_file;
+    std::string graph_file;
+    std::string generator;
+    std::string graph_name;
+    std::vector<std::string> edits; // "-I u,v,w" / "-R u,v", in command-line order
+    std::string order;
+    std::string zip;
     bool use_file = false;
     bool use_stdin = false;
     
     int opt;
-    while ((opt = ::getopt(argc, argv, "a:v:e:s:m:ih")) != -1) {
+    while ((opt = ::getopt(argc, argv, "a:v:e:s:m:f:n:I:R:g:o:z:ih")) != -1) {
         switch (opt) {
             case 'a':
                 algorithm = optarg;
@@ -160,6 +187,27 @@ int main(int argc, char* argv[]) {
                 matrix_file = optarg;
                 use_file = true;
                 break;
+            case 'f':
+                graph_file = optarg;
+                break;
+            case 'n':
+                graph_name = optarg;
+                break;
+            case 'I':
+                edits.push_back(std::string("-I ") + optarg);
+                break;
+            case 'R':
+                edits.push_back(std::string("-R ") + optarg);
+                break;
+            case 'g':
+                generator = optarg;
+                break;
+            case 'o':
+                order = optarg;
+                break;
+            case 'z':
+                zip = optarg;
+                break;
             case 'i':
                 use_stdin = true;
                 break;
@@ -182,15 +230,35 @@ int main(int argc, char* argv[]) {
     
     // בדיקת תקינות האלגוריתם
     if (algorithm != "EULERIAN" && algorithm != "SCC" && algorithm != "MST" && 
+        algorithm != "MST:PRIM" && algorithm != "MST:KRUSKAL" && algorithm != "MST:BORUVKA" &&
         algorithm != "MAXCLIQUE" && algorithm != "HAMILTON") {
         std::cerr << "Error: Unknown algorithm '" << algorithm << "'\n";
-        std::cerr << "Supported algorithms: EULERIAN, SCC, MST, MAXCLIQUE, HAMILTON\n";
+        std::cerr << "Supported algorithms: EULERIAN, SCC, MST, MST:PRIM, MST:KRUSKAL, MST:BORUVKA, MAXCLIQUE, HAMILTON\n";
         return 1;
     }
     
     std::string request;
     
-     if (use_stdin || (V == 0 && E == 0)) {
+    if (!graph_name.empty()) {
+        // The server keeps the graph; -v only matters when the first request creates it
+        std::ostringstream req_stream;
+        req_stream << "-a " << algorithm << " -n " << graph_name;
+        if (V > 0) req_stream << " -v " << V;
+        for (const std::string& edit : edits) req_stream << " " << edit;
+        req_stream << "\n";
+        request = req_stream.str();
+    } else if (!edits.empty()) {
+        std::cerr << "Error: -I and -R need -n <name>\n";
+        return 1;
+    } else if (!graph_file.empty()) {
+        // The server maps the file itself, so send an absolute path it can open
+        char resolved[PATH_MAX];
+        if (::realpath(graph_file.c_str(), resolved)) graph_file = resolved;
+
+        std::ostringstream req_stream;
+        req_stream << "-a " << algorithm << " -f " << graph_file << "\n";
+        request = req_stream.str();
+    } else if (use_stdin || (V == 0 && E == 0)) {
         
         
         std::ostringstream req_stream;
@@ -215,7 +283,11 @@ int main(int argc, char* argv[]) {
         req_stream << "-a " << algorithm
            << " -v " << V
            << " -e " << E
-           << " -s " << seed << "\n";
+           << " -s " << seed;
+        if (!generator.empty()) req_stream << " -g " << generator;
+        if (!order.empty()) req_stream << " -o " << order;
+        if (!zip.empty()) req_stream << " -z " << zip;
+        req_stream << "\n";
 request = req_stream.str();
 
     }
@@ -0,0 +1,405 @@
+/*
+** graphcheck.cpp -- behaviour checks for the graph library (run with "make check")
+**
+** Each check prints "ok <name>" or "FAIL <name>: <reason>".
+** The exit status is 1 if any check failed.
+*/
+
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "Graph.hpp"
+#include "GraphFile.hpp"
+#include "VersionedGraph.hpp"
+#include "IncrementalMST.hpp"
+#include "MST.hpp"
+#include "Hamilton.hpp"
+#include "MaxClique.hpp"
+
+static int failures = 0;
+
+static void expect(bool ok, const std::string& name, const std::string& reason) {
+    if (ok) {
+        std::cout << "ok " << name << "\n";
+    } else {
+        std::cout << "FAIL " << name << ": " << reason << "\n";
+        ++failures;
+    }
+}
+
+using Rows = std::vector<std::vector<std::pair<int,int>>>;
+
+// Every neighbor row (in stored order, with weights), copied out of the graph
+static Rows rowsOf(const Graph& g) {
+    Rows rows(g.getNumVertices());
+    for (int u = 0; u < g.getNumVertices(); ++u) {
+        for (const auto& neighbor : g.getNeighbors(u)) rows[u].push_back(neighbor);
+    }
+    return rows;
+}
+
+// Same vertices, direction and neighbor rows
+static bool sameGraph(const Graph& a, const Graph& b) {
+    return a.isDirected() == b.isDirected() && rowsOf(a) == rowsOf(b);
+}
+
+// generateRandomGraphParallel: one seed gives the same graph for any thread count
+static void checkParallelGenerator() {
+    struct Case { int V; long long E; bool directed; };
+    // Several row chunks each; the dense cases take the complement path
+    const std::vector<Case> cases = { {2000, 6000, false}, {2000, 6000, true}, {600, 150000, false}, {600, 300000, true} };
+    for (const Case& c : cases) {
+        for (std::uint64_t seed : {1u, 7u, 12345u}) {
+            Graph one = Graph::generateRandomGraphParallel(c.V, c.E, seed, c.directed, 1);
+            bool same = true;
+            for (int threads : {2, 3, 8}) {
+                same = same && sameGraph(one, Graph::generateRandomGraphParallel(c.V, c.E, seed, c.directed, threads));
+            }
+            std::string name = "parallel generator V=" + std::to_string(c.V) + " E=" + std::to_string(c.E) +
+                               (c.directed ? " directed" : " undirected") + " seed=" + std::to_string(seed);
+            expect(same, name, "graph differs between 1 thread and N threads");
+        }
+    }
+}
+
+// Overwrite one int32 of a saved graph file at byte position pos
+static void patchInt(const std::string& path, std::uint64_t pos, std::int32_t value) {
+    std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+    f.seekp(static_cast<std::streamoff>(pos));
+    f.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static bool mapRejected(const std::string& path) {
+    try {
+        MappedGraph file(path);
+        return false;
+    } catch (const std::invalid_argument&) {
+        return true;
+    }
+}
+
+// MappedGraph: a file whose entries point outside [0, V) or carry negative weights is refused on open
+static void checkMappedGraphValidation() {
+    const std::string path = "graphcheck.tmp";
+    Graph g = Graph::generateRandomGraph(20, 40, 3);
+    g.save(path);
+
+    GraphFileHeader h;
+    {
+        std::ifstream in(path, std::ios::binary);
+        in.read(reinterpret_cast<char*>(&h), sizeof(h));
+    }
+    const std::uint64_t last = h.numEntries - 1;
+
+    bool intact = !mapRejected(path);
+    patchInt(path, h.targetsPos + last * sizeof(std::int32_t), 20);
+    bool badTarget = mapRejected(path);
+    patchInt(path, h.targetsPos + last * sizeof(std::int32_t), -1);
+    bool negativeTarget = mapRejected(path);
+
+    g.save(path);
+    patchInt(path, h.weightsPos, -5);
+    bool negativeWeight = mapRejected(path);
+    std::remove(path.c_str());
+
+    expect(intact, "mapped graph accepts a saved file", "valid file rejected");
+    expect(badTarget, "mapped graph rejects target == V", "file accepted");
+    expect(negativeTarget, "mapped graph rejects a negative target", "file accepted");
+    expect(negativeWeight, "mapped graph rejects a negative weight", "file accepted");
+}
+
+// Hamilton and MaxClique above BitsetGraph::kMaxVertices: no bit matrix, same answers
+static void checkLargeGraphSearch() {
+    const int V = BitsetGraph::kMaxVertices + 1;
+    Graph g(V, false);
+    for (int v = 0; v < V; ++v) g.addEdge(v, (v + 1) % V, 1); // One cycle through every vertex
+    const int clique[] = {100, 2000, 9000, 20000, 30000};      // Plus a planted K5
+    for (int i = 0; i < 5; ++i) {
+        for (int j = i + 1; j < 5; ++j) g.addEdge(clique[i], clique[j], 1);
+    }
+
+    std::string ham = Hamilton().run(&g);
+    expect(ham.find("Hamilton Circuit found") == 0 && ham.find("Total circuit weight: " + std::to_string(V)) != std::string::npos,
+           "hamilton above the bit matrix limit", "circuit not found");
+    std::string mc = MaxClique().run(&g);
+    expect(mc == "Maximum clique size: 5\nMaximum clique vertices: {100, 2000, 9000, 20000, 30000}\n",
+           "max clique above the bit matrix limit", "got " + mc);
+}
+
+// removeEdge: random insertions and removals agree with a plain edge map, with either edge index
+static void checkEdgeRemoval() {
+    for (int V : {50, 3000}) {
+        for (bool directed : {false, true}) {
+            Graph g(V, directed);
+            g.buildEdgeIndex(V == 50 ? 1000 : 1); // Bit matrix, or the hash set (erase shifts probe runs back)
+            std::map<std::pair<int,int>, int> edges;
+            auto key = [&](int u, int v) { return directed || u < v ? std::make_pair(u, v) : std::make_pair(v, u); };
+
+            std::mt19937 rng(static_cast<unsigned>(V + directed));
+            for (int step = 0; step < 40000; ++step) {
+                int u = static_cast<int>(rng() % V), v = static_cast<int>(rng() % V);
+                if (u == v) continue;
+                auto it = edges.find(key(u, v));
+                if (it == edges.end()) {
+                    int w = static_cast<int>(rng() % 10);
+                    g.addEdge(u, v, w);
+                    edges[key(u, v)] = w;
+                } else if (rng() % 2) {
+                    g.removeEdge(u, v);
+                    edges.erase(it);
+                }
+            }
+
+            bool ok = true;
+            long long entries = 0;
+            for (int u = 0; u < V && ok; ++u) {
+                entries += g.get_out_degree(u);
+                for (const auto& neighbor : g.getNeighbors(u)) {
+                    auto it = edges.find(key(u, neighbor.first));
+                    ok = ok && it != edges.end() && it->second == neighbor.second;
+                }
+                ok = ok && static_cast<int>(g.getInNeighbors(u).size()) == g.get_in_degree(u);
+            }
+            ok = ok && entries == static_cast<long long>(edges.size()) * (directed ? 1 : 2);
+            for (int k = 0; k < 20000 && ok; ++k) {
+                int u = static_cast<int>(rng() % V), v = static_cast<int>(rng() % V);
+                if (u != v) ok = g.isEdgeConnected(u, v) == (edges.count(key(u, v)) > 0);
+            }
+            expect(ok, std::string("edge removal V=") + std::to_string(V) + (directed ? " directed" : " undirected"),
+                   "graph differs from the reference edge map");
+        }
+    }
+}
+
+// applyBatch: an invalid update rejects the whole batch; the graph and its version stay as they were
+static void checkFailedBatch() {
+    Graph g(10, false);
+    g.addEdge(0, 1, 3);
+    g.addEdge(1, 2, 4);
+    const Rows before = rowsOf(g);
+    const std::uint64_t version = g.getVersion();
+
+    Graph::EdgeBatch batch;
+    batch.remove(0, 1);
+    batch.insert(1, 0, 7);
+    batch.insert(3, 4, 1);
+    batch.remove(5, 6); // Not an edge
+    bool threw = false;
+    try {
+        g.applyBatch(batch);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    expect(threw && rowsOf(g) == before && g.getVersion() == version && !g.isEdgeConnected(3, 4),
+           "failed batch leaves graph and version unchanged", "graph or version changed");
+
+    Graph::EdgeBatch valid;
+    valid.remove(0, 1);
+    valid.insert(1, 0, 7);
+    g.applyBatch(valid);
+    expect(g.getVersion() == version + 1 && g.getNeighbors(0).size() == 1 && g.getNeighbors(0)[0].second == 7,
+           "valid batch applies all updates as one version", "unexpected graph or version");
+}
+
+// VersionedGraph: a snapshot keeps its adjacency after later batches are published
+static void checkSnapshots() {
+    VersionedGraph graph(Graph::generateRandomGraphGnm(200, 800, 5));
+    std::shared_ptr<const Graph> old = graph.snapshot();
+    const Rows before = rowsOf(*old);
+    const std::uint64_t version = old->getVersion();
+
+    Graph::EdgeBatch batch;
+    for (int u = 0; u < 200; u += 7) {
+        if (!old->getNeighbors(u).empty()) batch.remove(u, old->getNeighbors(u)[0].first);
+    }
+    const std::uint64_t published = graph.apply(batch);
+    std::shared_ptr<const Graph> now = graph.snapshot();
+
+    expect(rowsOf(*old) == before && old->getVersion() == version,
+           "snapshot unchanged by a later batch", "old snapshot was modified");
+    expect(published == version + 1 && now->getVersion() == published && rowsOf(*now) != before,
+           "later batch published as a new version", "new snapshot missing the batch");
+
+    Graph::EdgeBatch more;
+    more.insert(0, 199, 1);
+    bool threw = false;
+    try {
+        graph.apply(more, [](const Graph&) { throw std::runtime_error("derived state failed"); });
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    expect(threw && graph.snapshot() == now, "failed publish hook publishes nothing", "batch was published");
+}
+
+// True if forest holds edges of g (with their weights) and no cycle
+static bool isForestOf(const Graph& g, const std::vector<MST::Edge>& forest) {
+    std::vector<int> parent(g.getNumVertices());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&](int x) {
+        while (parent[x] != x) x = parent[x] = parent[parent[x]];
+        return x;
+    };
+    for (const MST::Edge& e : forest) {
+        bool stored = false;
+        for (const auto& neighbor : g.getNeighbors(e.u)) stored = stored || (neighbor.first == e.v && neighbor.second == e.weight);
+        int a = find(e.u), b = find(e.v);
+        if (!stored || a == b) return false;
+        parent[a] = b;
+    }
+    return true;
+}
+
+// IncrementalMST: after every batch (insertions, and removals of tree and non-tree edges)
+// the maintained forest weighs as much as a from-scratch Kruskal and spans as many components
+static void checkIncrementalMST() {
+    std::mt19937 rng(3);
+    for (int trial = 0; trial < 30; ++trial) {
+        const int V = 5 + trial * 3;
+        Graph g(V, false);
+        IncrementalMST incremental(g);
+        bool ok = true;
+        std::string reason;
+        for (int b = 0; b < 60 && ok; ++b) {
+            Graph::EdgeBatch batch;
+            std::set<std::pair<int,int>> touched; // One update per vertex pair, so the batch is valid
+            const int updates = 1 + static_cast<int>(rng() % 6);
+            for (int k = 0; k < updates; ++k) {
+                int u = static_cast<int>(rng() % V), v = static_cast<int>(rng() % V);
+                if (u == v || !touched.insert(std::minmax(u, v)).second) continue;
+                if (!g.isEdgeConnected(u, v)) batch.insert(u, v, static_cast<int>(rng() % 20));
+                else if (rng() % 4 == 0) batch.remove(u, v);
+            }
+            g.applyBatch(batch);
+            incremental.apply(batch, g);
+
+            std::vector<MST::Edge> kruskal = MST::spanningForest(g);
+            long long weight = 0;
+            for (const MST::Edge& e : kruskal) weight += e.weight;
+            const std::vector<MST::Edge> kept = incremental.edges();
+            if (weight != incremental.getTotalWeight()) {
+                ok = false;
+                reason = "batch " + std::to_string(b) + ": weight " + std::to_string(incremental.getTotalWeight()) +
+                         ", Kruskal " + std::to_string(weight);
+            } else if (incremental.getNumComponents() != V - static_cast<int>(kruskal.size()) ||
+                       kept.size() != kruskal.size() || !isForestOf(g, kept)) {
+                ok = false;
+                reason = "batch " + std::to_string(b) + ": not a spanning forest of the graph";
+            }
+        }
+        expect(ok, "incremental MST matches Kruskal, V=" + std::to_string(V), reason);
+    }
+}
+
+// What an MST run reports without its edge lines: connected or not, components with their
+// sizes and weights, and the total. Equal for every minimum spanning forest, ties or not.
+static std::string mstSummary(const std::string& out) {
+    std::istringstream in(out);
+    std::string summary, line;
+    while (std::getline(in, line)) {
+        if (line.find("(weight: ") == std::string::npos) summary += line + "\n";
+    }
+    return summary;
+}
+
+// Random undirected graph: `blocks` groups of `blockSize` vertices with edges inside a group only,
+// a ring through each group when `connect`, then `isolated` vertices; weights uniform in [0, maxWeight]
+static Graph mstCase(int blocks, int blockSize, int edgesPerBlock, bool connect, int isolated, int maxWeight,
+                     std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> weight(0, maxWeight);
+    std::vector<Graph::Edge> edges;
+    for (int b = 0; b < blocks; ++b) {
+        const int first = b * blockSize;
+        for (int i = 0; connect && i < blockSize; ++i) {
+            edges.push_back({first + i, first + (i + 1) % blockSize, weight(rng)});
+        }
+        for (int k = 0; k < edgesPerBlock; ++k) {
+            edges.push_back({first + static_cast<int>(rng() % blockSize), first + static_cast<int>(rng() % blockSize), weight(rng)});
+        }
+    }
+    edges.push_back({0, 1, maxWeight}); // The top of the range, dropped if 0-1 already exists
+    return Graph::fromEdges(blocks * blockSize + isolated, edges, false);
+}
+
+// MST engines: Prim and parallel Boruvka (1, 3 and 8 threads, so uneven vertex ranges) report
+// the same forest as Kruskal, on connected and disconnected graphs, narrow and 31-bit weights
+static void checkMstEngines() {
+    struct Case { const char* name; int blocks, blockSize, edgesPerBlock; bool connect; int isolated, maxWeight; };
+    const int wide = std::numeric_limits<int>::max();
+    const std::vector<Case> cases = {
+        {"connected, weights 0..10", 1, 500, 3000, true, 0, 10},
+        {"connected, 31-bit weights", 1, 500, 3000, true, 0, wide},
+        {"forest, weights 0..1000", 3, 150, 400, false, 60, 1000},
+        {"forest, 31-bit weights", 4, 120, 300, true, 37, wide},
+        {"sparse forest, 31-bit weights", 1, 700, 350, false, 0, wide},
+    };
+    for (std::size_t i = 0; i < cases.size(); ++i) {
+        const Case& c = cases[i];
+        const Graph g = mstCase(c.blocks, c.blockSize, c.edgesPerBlock, c.connect, c.isolated, c.maxWeight,
+                                static_cast<std::uint32_t>(11 + i));
+        const std::string kruskal = mstSummary(MST(MST::Method::Kruskal).run(&g));
+        const std::string prim = mstSummary(MST(MST::Method::Prim).run(&g));
+        expect(prim == kruskal, std::string("prim matches kruskal, ") + c.name, "got\n" + prim + "expected\n" + kruskal);
+        for (int threads : {1, 3, 8}) {
+            const std::string boruvka = mstSummary(MST(MST::Method::Boruvka, threads).run(&g));
+            expect(boruvka == kruskal, std::string("boruvka matches kruskal, ") + c.name + ", " + std::to_string(threads) +
+                   " threads", "got\n" + boruvka + "expected\n" + kruskal);
+        }
+    }
+}
+
+// Kruskal's counting sort (narrow weights) and its stable_sort fallback (range over 2^20) order
+// tied edges alike: a bridge of weight 2^31 - 1 to a spare vertex widens the range past the
+// counting limit and must only append itself to the forest
+static void checkKruskalSorts() {
+    struct Case { const char* name; int blocks, blockSize, edgesPerBlock; bool connect; int maxWeight; };
+    const std::vector<Case> cases = {
+        {"connected, weights 0..10", 1, 400, 2500, true, 10},
+        {"forest, weights 0..100", 3, 150, 500, false, 100},
+    };
+    for (std::size_t i = 0; i < cases.size(); ++i) {
+        const Case& c = cases[i];
+        const Graph narrow = mstCase(c.blocks, c.blockSize, c.edgesPerBlock, c.connect, 1, c.maxWeight,
+                                     static_cast<std::uint32_t>(31 + i));
+        Graph wide = narrow;
+        const int spare = wide.getNumVertices() - 1;
+        wide.addEdge(0, spare, std::numeric_limits<int>::max());
+
+        std::vector<MST::Edge> expected = MST::spanningForest(narrow);
+        expected.push_back({0, spare, std::numeric_limits<int>::max()});
+        const std::vector<MST::Edge> got = MST::spanningForest(wide);
+        bool same = got.size() == expected.size();
+        for (std::size_t k = 0; same && k < got.size(); ++k) {
+            same = got[k].u == expected[k].u && got[k].v == expected[k].v && got[k].weight == expected[k].weight;
+        }
+        expect(same, std::string("kruskal sorts agree on ties, ") + c.name, "different forest edges or order");
+    }
+}
+
+int main() {
+    checkParallelGenerator();
+    checkMappedGraphValidation();
+    checkLargeGraphSearch();
+    checkEdgeRemoval();
+    checkFailedBatch();
+    checkSnapshots();
+    checkIncrementalMST();
+    checkMstEngines();
+    checkKruskalSorts();
+
+    if (failures) std::cout << failures << " check(s) failed\n";
+    return failures ? 1 : 0;
+}
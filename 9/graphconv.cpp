@@ -0,0 +1,95 @@
+/*
+** graphconv.cpp -- convert an adjacency-matrix text file into the binary graph format
+**
+** Input (same text format as the Stage 6 server):
+**   <V>
+**   directed | undirected
+**   V rows of V integers; -1 means "no edge", any other value is the edge weight
+** Output: a graph file for Graph::load / MappedGraph (see GraphFile.hpp).
+**
+** Usage: graphconv <matrix.txt | -> <out.graph>
+*/
+
+#include <cstdio>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Graph.hpp"
+#include "GraphFile.hpp"
+
+static void print_usage(const char* prog_name) {
+    std::cerr << "Usage: " << prog_name << " <matrix.txt | -> <out.graph>\n"
+              << "  Reads an adjacency matrix (V, directed|undirected, V rows; -1 = no edge)\n"
+              << "  from the file or from stdin ('-') and writes it in binary form.\n";
+}
+
+// Read the matrix cell by cell into an edge list, without keeping the matrix itself
+static bool read_matrix(std::istream& in, int& V, bool& directed, std::vector<Graph::Edge>& edges, std::string& err) {
+    if (!(in >> V) || V <= 0) { err = "first line must be a positive number of vertices"; return false; }
+
+    std::string type;
+    in >> type;
+    if (type == "directed") directed = true;
+    else if (type == "undirected") directed = false;
+    else { err = "second line must be 'directed' or 'undirected'"; return false; }
+
+    for (int r = 0; r < V; ++r) {
+        for (int c = 0; c < V; ++c) {
+            int w;
+            if (!(in >> w)) {
+                err = "matrix ends early (row " + std::to_string(r) + ", column " + std::to_string(c) + ")";
+                return false;
+            }
+            if (w > -1) edges.push_back({r, c, w}); // There's an edge with weight w
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    const std::string input = argv[1], output = argv[2];
+
+    int V = 0;
+    bool directed = false;
+    std::vector<Graph::Edge> edges;
+    std::string err;
+    bool ok;
+    if (input == "-") {
+        ok = read_matrix(std::cin, V, directed, edges, err);
+    } else {
+        std::ifstream file(input);
+        if (!file) {
+            std::perror(input.c_str());
+            return 1;
+        }
+        ok = read_matrix(file, V, directed, edges, err);
+    }
+    if (!ok) {
+        std::cerr << "Error: " << err << "\n";
+        return 1;
+    }
+
+    try {
+        // Same rules as the Stage 6 loader: the mirrored cell of an undirected matrix is a duplicate
+        Graph::LoadReport report;
+        Graph g = Graph::fromEdges(V, edges, directed, Graph::DuplicatePolicy::KeepFirst, &report);
+        g.save(output);
+
+        std::printf("Wrote %s: %d vertices, %zu %s edges\n", output.c_str(), V, report.accepted,
+                    directed ? "directed" : "undirected");
+        if (report.rejected() > report.duplicates) {
+            std::printf("Rejected edges: %zu self-loops, %zu negative weights, %zu out of range\n",
+                        report.selfLoops, report.negativeWeight, report.outOfRange);
+        }
+    } catch (const std::exception& ex) {
+        std::cerr << "Error: " << ex.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -18,6 +18,8 @@
 #include <queue>
 #include <memory>
 #include <atomic>
+#include <map>
+#include <type_traits>
 
 #include <unistd.h>
 #include <sys/types.h>
@@ -26,6 +28,12 @@
 #include <errno.h>
 
 #include "Graph.hpp"
+#include "CsrGraph.hpp"
+#include "GraphFile.hpp"
+#include "CompressedGraph.hpp"
+#include "Reorder.hpp"
+#include "VersionedGraph.hpp"
+#include "IncrementalMST.hpp"
 #include "Algorithms.hpp"
 #include "Factory.hpp"   // headers available in your project (not strictly required here)
 #include "MST.hpp"
@@ -35,6 +43,8 @@
 
 #define SOCKET_PATH "mysocket"
 #define BACKLOG 64
+#define MAX_REQUEST (64 * 1024) // a request is one command line, never a graph
+#define MAX_NAMED_GRAPH_VERTICES (1 << 20) // named graphs live until shutdown, so this bounds their memory
 static std::atomic<bool> should_exit{false};
 
 // ======================= Utilities =======================
@@ -64,8 +74,35 @@ static std::string graphToString(const Graph& g) {
     return os.str();
 }
 
-// Parse a single-line request: -a <ALGO> -v <V> -e <E> -s <S>
-static bool handle_request_text(const std::string& req, std::string& alg, int& V, int& E, int& S, std::string& err) {
+// Random graph with the generator named by -g (legacy = Graph::generateRandomGraph).
+// gnp keeps E as the expected edge count; parallel uses all cores and gives the same graph as one thread.
+static Graph generateGraph(const std::string& gen, int V, int E, int S, bool directed) {
+    if (gen == "gnm") return Graph::generateRandomGraphGnm(V, E, static_cast<std::uint64_t>(S), directed);
+    if (gen == "gnp") {
+        double pairs = directed ? double(V) * (V - 1) : double(V) * (V - 1) / 2;
+        return Graph::generateRandomGraphGnp(V, pairs > 0 ? E / pairs : 0.0, static_cast<std::uint64_t>(S), directed);
+    }
+    if (gen == "parallel") return Graph::generateRandomGraphParallel(V, E, static_cast<std::uint64_t>(S), directed);
+    return Graph::generateRandomGraph(V, E, S, directed);
+}
+
+// "u,v,w" (count = 3) or "u,v" (count = 2)
+static bool parseEdgeArg(const std::string& text, int* values, int count) {
+    std::istringstream in(text);
+    for (int i = 0; i < count; ++i) {
+        char comma = ',';
+        if (i > 0 && !(in >> comma)) return false;
+        if (comma != ',' || !(in >> values[i])) return false;
+    }
+    return (in >> std::ws).eof();
+}
+
+// Parse a single-line request: -a <ALGO> -v <V> -e <E> -s <S> [-g <generator>] [-o <order>] [-z <encoding>]
+//   or  -a <ALGO> -f <graph file>
+//   or  -a <ALGO> -n <name> [-v <V>] [-I u,v,w]... [-R u,v]...   (named graph kept by the server, see below)
+static bool handle_request_text(const std::string& req, std::string& alg, int& V, int& E, int& S, std::string& file,
+                                std::string& gen, VertexOrdering& order, std::string& zip,
+                                std::string& name, Graph::EdgeBatch& batch, std::string& err) {
     std::istringstream iss(req);
     std::vector<std::string> args; std::string tok;
     while (iss >> tok) args.push_back(tok);
@@ -80,11 +117,51 @@ static bool handle_request_text(const std::string& req, std::string& alg, int& V
             try { E = std::stoi(args[++i]); hasE = true; } catch(...) { err = "invalid -e"; return false; }
         } else if (a == "-s" && i+1 < args.size()) {
             try { S = std::stoi(args[++i]); hasS = true; } catch(...) { err = "invalid -s"; return false; }
+        } else if (a == "-f" && i+1 < args.size()) {
+            file = args[++i];
+        } else if (a == "-n" && i+1 < args.size()) {
+            name = args[++i];
+        } else if (a == "-I" && i+1 < args.size()) {
+            int e[3];
+            if (!parseEdgeArg(args[++i], e, 3)) { err = "invalid -I (u,v,w)"; return false; }
+            batch.insert(e[0], e[1], e[2]);
+        } else if (a == "-R" && i+1 < args.size()) {
+            int e[2];
+            if (!parseEdgeArg(args[++i], e, 2)) { err = "invalid -R (u,v)"; return false; }
+            batch.remove(e[0], e[1]);
+        } else if (a == "-g" && i+1 < args.size()) {
+            gen = args[++i];
+            if (gen != "legacy" && gen != "gnm" && gen != "gnp" && gen != "parallel") {
+                err = "invalid -g (legacy, gnm, gnp or parallel)"; return false;
+            }
+        } else if (a == "-o" && i+1 < args.size()) {
+            try { order = parseVertexOrdering(args[++i]); } catch (const std::exception& ex) { err = ex.what(); return false; }
+        } else if (a == "-z" && i+1 < args.size()) {
+            zip = args[++i];
+            if (zip != "varint" && zip != "group") { err = "invalid -z (varint or group)"; return false; }
         } else {
             // ignore unknown tokens
         }
     }
     if (!hasA) { err = "missing -a <algorithm>"; return false; }
+    if (!name.empty()) {
+        if (!file.empty() || !gen.empty() || order != VertexOrdering::Identity || !zip.empty()) {
+            err = "-n cannot be combined with -f, -g, -o or -z"; return false;
+        }
+        if (hasV && V <= 0) { err = "V must be positive"; return false; }
+        if (V > MAX_NAMED_GRAPH_VERTICES) {
+            err = "named graphs are limited to " + std::to_string(MAX_NAMED_GRAPH_VERTICES) + " vertices"; return false;
+        }
+        return true;
+    }
+    if (!batch.empty()) { err = "-I and -R need -n <name>"; return false; }
+    if (!file.empty()) {
+        // the graph comes from the file, in the ids it was saved with
+        if (!gen.empty() || order != VertexOrdering::Identity || !zip.empty()) {
+            err = "-g, -o and -z apply to generated graphs only"; return false;
+        }
+        return true;
+    }
     if (!hasV || !hasE || !hasS) { err = "missing one of -v/-e/-s"; return false; }
     if (V <= 0) { err = "V must be positive"; return false; }
     if (E < 0)  { err = "E cannot be negative"; return false; }
@@ -128,8 +205,16 @@ struct Job {
     int client_fd = -1;               // client's socket fd (for logging)
 
     int V=0, E=0, S=0;                // graph params
+    MST::Method mstMethod = MST::Method::Auto; // from "-a MST:PRIM" / "-a MST:KRUSKAL"
     std::shared_ptr<Graph> gUndir;    // undirected graph (MST/HAMILTON/MAXCLIQUE)
     std::shared_ptr<Graph> gDir;      // directed graph (SCC)
+    std::shared_ptr<const CompactCsrGraph> csrUndir; // frozen snapshots read by the stages
+    std::shared_ptr<const CompactCsrGraph> csrDir;
+    std::shared_ptr<const CompressedGraph> zipUndir; // compressed rows instead of the CSR snapshots, if requested
+    std::shared_ptr<const CompressedGraph> zipDir;
+    std::shared_ptr<const MappedGraph> file; // graph file for all stages (instead of the twins), if requested
+    std::shared_ptr<const CsrGraph> named;   // frozen snapshot of a named graph for all stages, if requested
+    std::shared_ptr<const std::vector<MST::Edge>> forest; // its maintained minimum spanning forest (for "-a MST")
 
     std::string header;               // "=== Random Graphs (Pipeline) === ..." text
     std::string mst, scc, ham, mc;    // per-algorithm outputs
@@ -150,17 +235,71 @@ static BlockingQueue<JobPtr> Q_mc;
 
 static std::atomic<int>  g_nextJobId{1};
 
+// ======================= Named Graphs =======================
+
+// Undirected graphs kept between requests ("-n <name>"). A request's -I/-R edits form one batch,
+// applied all-or-nothing; its job then reads the published snapshot, so later batches never
+// change a job already in the pipeline. Each graph also keeps its minimum spanning forest up
+// to date batch by batch (IncrementalMST), which the MST stage reports instead of recomputing.
+// Entries are never removed.
+struct NamedGraph {
+    std::mutex mtx;                   // one batch at a time, so graph and mst stay in step
+    VersionedGraph graph;
+    IncrementalMST mst;               // forest of the published version; replaced only once it is published
+
+    explicit NamedGraph(int V) : graph(Graph(V, /*directed=*/false)), mst(*graph.snapshot()) {}
+};
+static_assert(std::is_nothrow_move_assignable<IncrementalMST>::value, "replacing a named graph's forest must not fail");
+
+static const size_t MAX_NAMED_GRAPHS = 64;
+static std::mutex g_namedMutex;
+static std::map<std::string, std::unique_ptr<NamedGraph>> g_named;
+
+// The named graph, created with V vertices if it does not exist yet; nullptr and err on failure.
+// Creating one allocates, so this can throw; the map is unchanged if it does.
+static NamedGraph* find_named_graph(const std::string& name, int V, std::string& err) {
+    std::lock_guard<std::mutex> lk(g_namedMutex);
+    auto it = g_named.find(name);
+    if (it == g_named.end()) {
+        if (V <= 0) { err = "no graph named '" + name + "' (create it with -v <V>)"; return nullptr; }
+        if (g_named.size() >= MAX_NAMED_GRAPHS) { err = "too many named graphs"; return nullptr; }
+        it = g_named.emplace(name, std::make_unique<NamedGraph>(V)).first;
+    } else if (V > 0 && V != it->second->graph.snapshot()->getNumVertices()) {
+        err = "graph '" + name + "' has " + std::to_string(it->second->graph.snapshot()->getNumVertices()) + " vertices";
+        return nullptr;
+    }
+    return it->second.get();
+}
+
 // ======================= Pipeline Stages =======================
 
+// The graph each stage reads: the mapped file if one was given, else the compressed or CSR snapshot
+static GraphView undirectedView(const Job& job) {
+    if (job.file) return job.file.get();
+    if (job.named) return job.named.get();
+    if (job.zipUndir) return job.zipUndir.get();
+    return job.csrUndir.get();
+}
+
+static GraphView directedView(const Job& job) {
+    if (job.file) return job.file.get();
+    if (job.named) return job.named.get();
+    if (job.zipDir) return job.zipDir.get();
+    return job.csrDir.get();
+}
+
 static void stage_mst() {
-    MST alg; // uses Graph& -> std::string
     while (!should_exit.load()) {
         JobPtr job = Q_mst.pop();
         if (should_exit.load() || !job) break;
+        MST alg(job->mstMethod); // GraphView -> std::string
 
         std::printf("[MST] start job %d\n", job->id);
         try {
-            job->mst = alg.run(*job->gUndir);
+            if (job->forest && job->mstMethod == MST::Method::Auto)
+                job->mst = MST::report(*job->named, *job->forest); // kept up to date by the named graph
+            else
+                job->mst = alg.run(undirectedView(*job));
         } catch (const std::exception& ex) {
             job->mst = std::string("ERROR: ") + ex.what() + "\n";
         } catch (...) {
@@ -181,7 +320,7 @@ static void stage_scc() {
 
         std::printf("[SCC] start job %d\n", job->id);
         try {
-            job->scc = alg.run(*job->gDir);
+            job->scc = alg.run(directedView(*job));
         } catch (const std::exception& ex) {
             job->scc = std::string("ERROR: ") + ex.what() + "\n";
         } catch (...) {
@@ -202,7 +341,7 @@ static void stage_ham() {
 
         std::printf("[HAMILTON] start job %d\n", job->id);
         try {
-            job->ham = alg.run(*job->gUndir);
+            job->ham = alg.run(undirectedView(*job));
         } catch (const std::exception& ex) {
             job->ham = std::string("ERROR: ") + ex.what() + "\n";
         } catch (...) {
@@ -223,7 +362,7 @@ static void stage_mc() {
 
         std::printf("[MAXCLIQUE] start job %d\n", job->id);
         try {
-            job->mc = alg.run(*job->gUndir);
+            job->mc = alg.run(undirectedView(*job));
         } catch (const std::exception& ex) {
             job->mc = std::string("ERROR: ") + ex.what() + "\n";
         } catch (...) {
@@ -262,9 +401,17 @@ static void handle_client(int client_fd) {
             if (n == 0) break;                       // EOF
             if (n < 0) { if (errno == EINTR) continue; break; }
             req.append(buf, buf + n);
+            if (req.size() > MAX_REQUEST) break;     // stop buffering a runaway request
         }
     }
 
+    if (req.size() > MAX_REQUEST) {
+        std::string msg = "ERROR: request longer than " + std::to_string(MAX_REQUEST) + " bytes\n";
+        (void)send_all(client_fd, msg.c_str(), msg.size());
+        ::close(client_fd);
+        return;
+    }
+
     // Trim trailing newlines/spaces for prettier logging (optional)
     while (!req.empty() && (req.back()=='\n' || req.back()=='\r' || std::isspace((unsigned char)req.back())))
         req.pop_back();
@@ -272,11 +419,17 @@ static void handle_client(int client_fd) {
     std::printf("<<< [fd %d -> server] received %zu bytes:\n%s\n", client_fd, req.size(), req.c_str());
 
     // parse
-    std::string alg; int V=0, E=0, S=0; std::string err;
-    if (!handle_request_text(req, alg, V, E, S, err)) {
+    std::string alg; int V=0, E=0, S=0; std::string path, err;
+    VertexOrdering order = VertexOrdering::Identity;
+    std::string gen, zip, name;
+    Graph::EdgeBatch batch;
+    if (!handle_request_text(req, alg, V, E, S, path, gen, order, zip, name, batch, err)) {
         std::ostringstream os;
         os << "ERROR: " << err << "\n"
-           << "Usage: -a <ALGO> -v <V> -e <E> -s <S>\n";
+           << "Usage: -a <ALGO> -v <V> -e <E> -s <S> [-g legacy|gnm|gnp|parallel]"
+           << " [-o none|rcm|degree|degeneracy|bfs] [-z varint|group]"
+           << "  or  -a <ALGO> -f <graph file>"
+           << "  or  -a <ALGO> -n <name> [-v <V>] [-I u,v,w]... [-R u,v]...\n";
         std::string msg = os.str();
         (void)send_all(client_fd, msg.c_str(), msg.size());
         ::close(client_fd);
@@ -288,27 +441,107 @@ static void handle_client(int client_fd) {
     job->id = g_nextJobId.fetch_add(1, std::memory_order_relaxed);
     job->client_fd = client_fd;
     job->V = V; job->E = E; job->S = S;
+    MST::parseMethod(alg, job->mstMethod); // other algorithm names keep Auto
 
-    std::printf("[JOB %d] created for client fd %d (V=%d,E=%d,S=%d)\n", job->id, client_fd, V, E, S);
+    if (!name.empty()) {
+        // Named graph: apply this request's batch, then run on the version it produced
+        std::string msg;
+        std::shared_ptr<const Graph> snapshot;
+        const char* failure = "cannot create graph";
+        try {
+            if (NamedGraph* graph = find_named_graph(name, V, err)) {
+                failure = "batch rejected, graph unchanged";
+                std::lock_guard<std::mutex> lk(graph->mtx);
+                if (!batch.empty()) {
+                    // The forest is updated on a copy (O(V), like the freeze below) before the graph is
+                    // published, so a failure in either leaves both at the previous version
+                    IncrementalMST mst = graph->mst;
+                    graph->graph.apply(batch, [&](const Graph& next) { mst.apply(batch, next); });
+                    graph->mst = std::move(mst);
+                }
+                snapshot = graph->graph.snapshot();
+                job->forest = std::make_shared<const std::vector<MST::Edge>>(graph->mst.edges());
+                job->named = std::make_shared<const CsrGraph>(snapshot->freeze());
+            } else {
+                msg = "ERROR: " + err + "\n";
+            }
+        } catch (const std::exception& ex) {
+            msg = std::string("ERROR: ") + failure + ": " + ex.what() + "\n";
+        }
+        if (!msg.empty()) {
+            (void)send_all(client_fd, msg.c_str(), msg.size());
+            ::close(client_fd);
+            return;
+        }
+        job->V = snapshot->getNumVertices();
 
-    // Generate twin graphs
-    try {
-        job->gUndir = std::make_shared<Graph>( Graph::generateRandomGraph(V, E, S, /*directed=*/false) );
-        job->gDir   = std::make_shared<Graph>( Graph::generateRandomGraph(V, E, S, /*directed=*/true) );
-    } catch (const std::exception& ex) {
-        std::string msg = std::string("ERROR: generateRandomGraph failed: ") + ex.what() + "\n";
-        (void)send_all(client_fd, msg.c_str(), msg.size());
-        ::close(client_fd);
-        return;
-    }
+        std::printf("[JOB %d] created for client fd %d (graph %s, version %llu, %zu updates)\n", job->id, client_fd,
+                    name.c_str(), static_cast<unsigned long long>(snapshot->getVersion()), batch.size());
+
+        std::ostringstream head;
+        head << "=== Named Graph (Pipeline) ===\n"
+             << name << " (version " << snapshot->getVersion() << "): " << job->V << " vertices, "
+             << job->named->getNumEdges() / 2 << " edges\n"
+             << graphToString(*snapshot);
+        job->header = head.str();
+    } else if (!path.empty()) {
+        // Saved graph: map it instead of generating (one validating scan, no parsing)
+        try {
+            job->file = std::make_shared<const MappedGraph>(path);
+        } catch (const std::exception& ex) {
+            std::string msg = std::string("ERROR: cannot open graph file: ") + ex.what() + "\n";
+            (void)send_all(client_fd, msg.c_str(), msg.size());
+            ::close(client_fd);
+            return;
+        }
+        job->V = job->file->getNumVertices();
+
+        std::printf("[JOB %d] created for client fd %d (file %s, V=%d)\n", job->id, client_fd, path.c_str(), job->V);
 
-    // Build header (graphs overview printed back to client)
-    {
         std::ostringstream head;
-        head << "=== Random Graphs (Pipeline) ===\n";
-        head << "--- Undirected ---\n" << graphToString(*job->gUndir);
-        head << "--- Directed ---\n"   << graphToString(*job->gDir);
+        head << "=== Graph File (Pipeline) ===\n"
+             << path << ": " << job->V << " vertices, " << job->file->getNumEdges() << " adjacency entries, "
+             << (job->file->isDirected() ? "directed" : "undirected") << "\n";
         job->header = head.str();
+    } else {
+        std::printf("[JOB %d] created for client fd %d (V=%d,E=%d,S=%d)\n", job->id, client_fd, V, E, S);
+
+        // Generate twin graphs
+        try {
+            job->gUndir = std::make_shared<Graph>( generateGraph(gen, V, E, S, /*directed=*/false) );
+            job->gDir   = std::make_shared<Graph>( generateGraph(gen, V, E, S, /*directed=*/true) );
+            // The stages only read the graphs, so freeze them once into contiguous CSR arrays
+            // (generated weights are 1..10, so the compact 8-bit weight layout always fits)
+            std::shared_ptr<const Graph> undir = job->gUndir, dir = job->gDir;
+            if (order != VertexOrdering::Identity) {
+                // Renumber for locality before freezing; results still come back in the generated ids
+                undir = std::make_shared<const Graph>( undir->relabel(computeOrder(*undir, order)) );
+                dir   = std::make_shared<const Graph>( dir->relabel(computeOrder(*dir, order)) );
+            }
+            if (zip.empty()) {
+                job->csrUndir = std::make_shared<const CompactCsrGraph>( *undir );
+                job->csrDir   = std::make_shared<const CompactCsrGraph>( *dir );
+            } else {
+                // Sorted, gap-encoded rows, decoded while the stages iterate (see CompressedGraph.hpp)
+                AdjacencyEncoding encoding = zip == "group" ? AdjacencyEncoding::GroupVarint : AdjacencyEncoding::Varint;
+                job->zipUndir = std::make_shared<const CompressedGraph>( *undir, encoding );
+                job->zipDir   = std::make_shared<const CompressedGraph>( *dir, encoding );
+            }
+        } catch (const std::exception& ex) {
+            std::string msg = std::string("ERROR: generateRandomGraph failed: ") + ex.what() + "\n";
+            (void)send_all(client_fd, msg.c_str(), msg.size());
+            ::close(client_fd);
+            return;
+        }
+
+        // Build header (graphs overview printed back to client)
+        {
+            std::ostringstream head;
+            head << "=== Random Graphs (Pipeline) ===\n";
+            head << "--- Undirected ---\n" << graphToString(*job->gUndir);
+            head << "--- Directed ---\n"   << graphToString(*job->gDir);
+            job->header = head.str();
+        }
     }
 
     std::printf("[JOB %d] enqueue to MST stage\n", job->id);